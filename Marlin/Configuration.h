@@ -875,6 +875,11 @@
 // This will remove the need to poll the interrupt pins, saving many CPU cycles.
 //#define ENDSTOP_INTERRUPTS_FEATURE
 
+// Stamp each endstop interrupt with the CPU cycle counter and back out the steps
+// taken after the edge, so a fast homing move still records the exact trigger step.
+// (Requires ENDSTOP_INTERRUPTS_FEATURE. STM32F1 (Maple) and LINUX only.)
+//#define ENDSTOP_EDGE_TIMESTAMPS
+
 /**
  * Endstop Noise Threshold
  *
@@ -1615,6 +1620,14 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Bicubic (Catmull-Rom) interpolation between the probed points.
+    // The same smooth surface as ABL_BILINEAR_SUBDIVISION, evaluated directly
+    // from the grid with no virtual grid. Uses 12 bytes of RAM per probe point.
+    // Cartesian machines need SEGMENT_LEVELED_MOVES to follow the curves.
+    //
+    //#define ABL_BICUBIC
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -1637,6 +1650,14 @@
   //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5 // When the nozzle is off the mesh, this value is used
                                           // as the Z-Height correction value.
 
+  /**
+   * Keep bilinear coefficients for each mesh cell, refreshed when the mesh changes.
+   * Segmented moves (Delta) then walk from cell to cell, needing a few multiply-adds
+   * per segment. Costs 16 bytes of RAM per cell.
+   * (With PLANNER_BENCHMARK, D113 compares it with get_z_correction.)
+   */
+  //#define UBL_CELL_CACHE
+
   //#define UBL_MESH_WIZARD         // Run several commands in a row to get a complete mesh
 
 #elif ENABLED(MESH_BED_LEVELING)
@@ -979,6 +979,23 @@
   #define SLOWDOWN_DIVISOR 2
 #endif
 
+/**
+ * Time-based planner buffer
+ *
+ * Fill the planner by the time its moves will take, not by block count. With
+ * tiny segments a full buffer may hold only milliseconds of motion, and with
+ * long moves it may hold minutes. New moves wait while PLANNER_BUFFER_TIME_MAX
+ * of motion is queued, so pause and feedrate changes respond quickly. SLOWDOWN
+ * kicks in when less than PLANNER_BUFFER_TIME_MIN is queued, instead of when the
+ * buffer is SLOWDOWN_DIVISOR full. Set with M595 L<ms> H<ms>. M595 reports the
+ * buffered time to the host.
+ */
+//#define PLANNER_BUFFER_TIME
+#if ENABLED(PLANNER_BUFFER_TIME)
+  #define PLANNER_BUFFER_TIME_MIN   250 // (ms) Slow down with less motion queued. Set with M595 L.
+  #define PLANNER_BUFFER_TIME_MAX  2000 // (ms) Queue no more motion than this (0 = no limit). Set with M595 H.
+#endif
+
 /**
  * XY Frequency limit
  * Reduce resonance by limiting the frequency of small zigzag infill moves.
@@ -1013,6 +1030,14 @@
   // to reduce print artifacts. (Enabling this is costly in memory and computation!)
   //#define BACKLASH_SMOOTHING_MM 3 // (mm)
 
+  // Take up backlash with a separate step stream at the start of each reversing
+  // segment, leaving the segment's own trapezoid and E ratio untouched.
+  // (Not compatible with BACKLASH_SMOOTHING_MM or Input Shaping.)
+  //#define BACKLASH_STREAM
+  #if ENABLED(BACKLASH_STREAM)
+    #define BACKLASH_STREAM_RATE 10000 // (steps/s) Takeup step rate on each axis
+  #endif
+
   // Add runtime configuration and tuning of backlash values (M425)
   //#define BACKLASH_GCODE
 
@@ -1102,6 +1127,66 @@
  */
 #define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Compute block trapezoids and S-curve timing with 64-bit integer math instead of
+ * float division and square root. A big saving on CPUs without an FPU (e.g., STM32F1)
+ * at high segment rates. The results are exact, so they may differ by one step or
+ * timer tick from the float path, which carries rounding error. (See D111.)
+ */
+#define FIXED_POINT_TRAPEZOID
+
+/**
+ * Precompute the step timing of upcoming blocks in the main loop. For the next few
+ * blocks the first timer intervals of the acceleration and deceleration ramps are
+ * evaluated ahead of time, so the Stepper ISR streams them instead of evaluating the
+ * speed curve and dividing at every step. Longer ramps continue with the live calculation.
+ * Only 32-bit MCUs. Uses about 8 * STEP_TIMING_BLOCKS * STEP_TIMING_TABLE_SIZE bytes of SRAM.
+ */
+#define STEP_TIMING_TABLE
+#if ENABLED(STEP_TIMING_TABLE)
+  #define STEP_TIMING_BLOCKS       4  // Blocks prepared ahead of the Stepper (power of 2)
+  #define STEP_TIMING_TABLE_SIZE  32  // Timer intervals per ramp (max 255)
+#endif
+
+/**
+ * Input Shaping
+ *
+ * Cancel the ringing of the frame at its resonant frequency by splitting each X/Y step
+ * into delayed impulses (ZV, ZVD or MZV shaper). Requires a 32-bit MCU.
+ * The shaper is suspended for moves that an endstop may interrupt (homing, probing).
+ *
+ * M593 [X] [Y] [F<hz>] [D<zeta>] [T<type>] : Set frequency (0 = off), damping ratio and shaper type.
+ */
+//#define INPUT_SHAPING_X
+//#define INPUT_SHAPING_Y
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #if ENABLED(INPUT_SHAPING_X)
+    #define SHAPING_FREQ_X  40        // (Hz) The default dominant resonant frequency on the X axis.
+    #define SHAPING_ZETA_X  0.15f     // Damping ratio of the X axis (0.0 - 0.5).
+    #define SHAPING_TYPE_X  0         // Shaper of the X axis. 0:ZV 1:ZVD 2:MZV
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    #define SHAPING_FREQ_Y  40        // (Hz) The default dominant resonant frequency on the Y axis.
+    #define SHAPING_ZETA_Y  0.15f     // Damping ratio of the Y axis (0.0 - 0.5).
+    #define SHAPING_TYPE_Y  0         // Shaper of the Y axis. 0:ZV 1:ZVD 2:MZV
+  #endif
+  #define SHAPING_MIN_FREQ  25        // (Hz) Lowest frequency allowed by M593. Lower values need more SRAM.
+  //#define SHAPING_MAX_STEPRATE 10000 // (steps/s) Highest shaped axis step rate. Default from steps/mm and max feedrate.
+#endif
+
+/**
+ * Stepper ISR Profiler
+ *
+ * Measure the CPU cycles spent in the Stepper ISR and in each of its phases (pulse,
+ * block, Linear Advance, babystepping, input shaping) to see the headroom left while
+ * printing. Uses the DWT cycle counter on ARM and clock_gettime on native (LINUX).
+ *
+ * M197      : Report ISR load and min/avg/max cycles with a log2 histogram per phase.
+ * M197 R    : Report, then reset the statistics.
+ * M197 S<0|1> : Pause or resume sampling.
+ */
+//#define STEPPER_ISR_PROFILE
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1839,6 +1924,12 @@
 #define BABYSTEPPING
 #if ENABLED(BABYSTEPPING)
   //#define INTEGRATED_BABYSTEPPING         // EXPERIMENTAL integration of babystepping into the Stepper ISR
+  #if ENABLED(INTEGRATED_BABYSTEPPING)
+    //#define BABYSTEP_SMOOTHING            // Work off large adjustments gradually, without pausing X/Y motion
+    #if ENABLED(BABYSTEP_SMOOTHING)
+      #define BABYSTEP_SMOOTH_TIME 0.05     // (s) Queued babysteps go out at (queued / BABYSTEP_SMOOTH_TIME) steps/s
+    #endif
+  #endif
   //#define BABYSTEP_WITHOUT_HOMING
   //#define BABYSTEP_ALWAYS_AVAILABLE       // Allow babystepping at all times (not just during movement).
   //#define BABYSTEP_XY                     // Also enable X/Y Babystepping. Not supported on DELTA!
@@ -1889,6 +1980,20 @@
   #define LIN_ADVANCE_K 0.23    // Unit: mm compression per 1mm/s extruder speed
   //#define LA_DEBUG            // If enabled, this will generate debug information output over USB.
   #define EXPERIMENTAL_SCURVE // Enable this option to permit S-Curve Acceleration
+
+  /**
+   * Pressure profile: The planner gives each block its advance per unit of step rate, and
+   * the Stepper block phase keeps the advance at K * E speed along the block's own speed
+   * curve, trapezoid or S-curve. No separate advance timer rate, so it holds at high E step
+   * rates. The advance may be smoothed over LA_SMOOTH_TIME, like pressure_advance_smooth_time.
+   * Requires a 32-bit MCU.
+   *
+   * M900 W<seconds> : Set the smoothing time (0 = off).
+   */
+  //#define LA_PRESSURE_PROFILE
+  #if ENABLED(LA_PRESSURE_PROFILE)
+    #define LA_SMOOTH_TIME 0.02 // (s) Smoothing time of the advance. 0 to disable.
+  #endif
 #endif
 
 // @section leveling
@@ -2034,14 +2139,34 @@
   //#define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Mi
   #define MIN_ARC_SEGMENTS       24 // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50 // Use feedrate to choose segment length (with MM_PER_ARC_SEGMENT as the minimum)
+  //#define ARC_CHORD_TOLERANCE 0.01 // (mm) Use radius to choose segment length for this max chord deviation (lengthened to keep up with the feedrate)
   #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
   //#define SF_ARC_FIX              // Enable only if using SkeinForge with "Arc Point" fillet procedure
+
+  /**
+   * Queue each XY arc as a single planner block, traced by a circle
+   * interpolator in the Stepper ISR instead of many short lines.
+   * Arc speed is limited so the centripetal acceleration stays within
+   * the X/Y max acceleration. Arcs fall back to segments when leveling
+   * is active, outside the XY plane, or if they could cross a software
+   * endstop. Requires a 32-bit Cartesian machine.
+   */
+  //#define ARC_BLOCKS
 #endif
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 //#define BEZIER_CURVE_SUPPORT
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  /**
+   * Split G5 curves into spans that stay within this distance of the
+   * true curve, slowing down where the curvature would exceed the X/Y
+   * max acceleration. With ARC_BLOCKS gentle stretches of the curve are
+   * queued as arcs, for far fewer blocks.
+   */
+  //#define BEZIER_CURVE_TOLERANCE 0.01 // (mm)
+#endif
 
 /**
  * Direct Stepping
@@ -2133,12 +2258,83 @@
   #define BLOCK_BUFFER_SIZE 32
 #endif
 
+/**
+ * Incremental look-ahead
+ *
+ * Stop the planner's reverse pass at the first block whose entry speed doesn't
+ * change, then begin the forward pass and trapezoid update from that block
+ * instead of re-walking the whole buffer for every new move. This is a large
+ * saving with dense small-segment G-code and a big BLOCK_BUFFER_SIZE.
+ * (With PLANNER_BENCHMARK, D110 reports the kernel invocations saved per move.)
+ */
+#define PLANNER_INCREMENTAL_RECALC
+
+/**
+ * Corner Blending
+ *
+ * Round off the corners between straight moves with a short arc that stays
+ * within a path tolerance of the programmed corner. Tessellated curves are then
+ * printed at speed instead of slowing down for the junction at every vertex.
+ * Each move is held back until the next one arrives, and the arc is fed to the
+ * planner as a few chords. Set the tolerance with 'G64 P<mm>' (P0 = exact corners).
+ * Cartesian and Core machines only. This changes the printed path, so keep the
+ * tolerance well under the line width.
+ */
+//#define CORNER_BLENDING
+#if ENABLED(CORNER_BLENDING)
+  #define CORNER_BLENDING_TOLERANCE  0.02 // (mm) Default path tolerance
+  #define CORNER_BLENDING_MAX_ANGLE    15 // (°) Maximum turn per chord of the arc
+#endif
+
+/**
+ * Segment Merging
+ *
+ * Merge runs of nearly collinear moves, like the tiny segments sliced from a
+ * curved surface, into one longer move before they reach the planner. Fewer
+ * blocks are planned, so the buffer covers more distance at high speed. Only
+ * moves with the same feedrate, tool and extrusion rate are merged, and every
+ * skipped vertex must stay within the tolerance. Set it with 'G64 Q<mm>' (Q0 = off).
+ * Cartesian and Core machines only.
+ */
+//#define SEGMENT_MERGING
+#if ENABLED(SEGMENT_MERGING)
+  #define SEGMENT_MERGING_TOLERANCE    0.005 // (mm) Max distance of a skipped vertex from the merged move
+  #define SEGMENT_MERGING_MAX_ANGLE        2 // (°) Max turn of a segment from the merged move
+  #define SEGMENT_MERGING_E_TOLERANCE   0.02 // Max E error of a skipped vertex, as a fraction of the merged E
+  #define SEGMENT_MERGING_MAX_SEGMENTS     8 // Max segments merged into one move
+#endif
+
+/**
+ * Incremental Inverse Kinematics
+ *
+ * Delta and SCARA split moves into many short segments, each needing a full
+ * inverse kinematics solution (3 square roots on a Delta). With this option
+ * the exact solution is only done every INCREMENTAL_IK_SPAN segments, with the
+ * joints in between following a parabola through the nearby exact solutions.
+ * Spans where the parabola doesn't fit well enough are solved exactly.
+ * This allows a higher DELTA_SEGMENTS_PER_SECOND on boards without an FPU.
+ * Use D112 (PLANNER_BENCHMARK) to check the error and the time saved.
+ */
+//#define INCREMENTAL_IK
+#if ENABLED(INCREMENTAL_IK)
+  #define INCREMENTAL_IK_SPAN 4       // Segments between exact solutions
+#endif
+
 // @section serial
 
 // The ASCII buffer for serial input
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 32
 
+// Store queued commands end to end in a shared arena instead of BUFSIZE
+// fixed slots of MAX_CMD_SIZE bytes. Short moves take only the space they
+// need, so BUFSIZE (up to 255) can hold 3-4x more commands in the same RAM,
+// and a longer MAX_CMD_SIZE (for long M117 / M118 lines) costs much less.
+//#define GCODE_QUEUE_ARENA
+#if ENABLED(GCODE_QUEUE_ARENA)
+  #define GCODE_QUEUE_ARENA_SIZE 3072   // (bytes) Shared by all queued commands
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -2176,6 +2372,19 @@
 // Not supported on all platforms.
 //#define RX_BUFFER_MONITOR
 
+// Receive host serial by DMA into a circular RX_BUFFER_SIZE buffer, with no
+// interrupt per byte. The command queue can then read whole lines in place.
+// Overruns aren't detected, so the host must never get RX_BUFFER_SIZE bytes
+// ahead of the firmware. (STM32F1 hardware USART only.)
+// DMA channels used: USART1 DMA1 Ch5 (shared with SPI2_TX), USART2 DMA1 Ch6,
+// USART3 DMA1 Ch3 (shared with SPI1_TX), UART4 DMA2 Ch3. UART5 has no DMA.
+//#define SERIAL_DMA_RX
+
+// Take complete lines straight from the serial receive buffer, copying each
+// line only once, into the command queue. Needs a port with bulk reads
+// (SERIAL_DMA_RX or LINUX native). Partial lines are read by character.
+//#define SERIAL_INPLACE_LINES
+
 /**
  * Emergency Command Parser
  *
@@ -3644,6 +3853,17 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+
+  /**
+   * Parse each command as it's queued and keep the result in the queue,
+   * with its first numbers already converted. Commands are dispatched
+   * without scanning the text or converting those numbers again.
+   * Uses 44 + 4 * PRECOMPILED_GCODE_VALUES bytes of SRAM per BUFSIZE.
+   */
+  //#define PRECOMPILED_GCODE
+  #if ENABLED(PRECOMPILED_GCODE)
+    #define PRECOMPILED_GCODE_VALUES 6  // Numbers kept per command. Others are converted when used.
+  #endif
 #endif
 
 // Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
@@ -4154,6 +4374,30 @@
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
+#if ENABLED(MARLIN_DEV_MODE)
+  /**
+   * D110 Planner benchmark. Stream a synthetic path or an SD G-code file through the
+   * planner with the Stepper ISR held off and report moves/s, worst-case recalculate()
+   * latency and cycle histograms for buffer_line and the planner passes.
+   *   D110 [P<pattern>] [S<moves>] [L<segment mm>] [R<radius mm>] [F<mm/min>] [/file.gco]
+   *   Patterns: 0 = small-segment curve, 1 = dense arc, 2 = zigzag infill
+   * Works on the linux_native environment for off-target measurements.
+   *
+   * D111 [S<count>] Compare FIXED_POINT_TRAPEZOID results with the float path for
+   * random blocks and report any mismatches.
+   *
+   * D112 [S<lines>] [L<segment mm>] Compare INCREMENTAL_IK with exact kinematics for
+   * random segmented lines. Report the CPU time per segment and the worst joint error.
+   *
+   * D113 [S<lines>] [L<segment mm>] Compare the UBL_CELL_CACHE walker with get_z_correction
+   * for random segmented lines over the mesh. Report the CPU time per segment and the worst
+   * difference. (M420 S2 fills the mesh with random values.)
+   *
+   * D114 [S<lines>] Time G1 lines from text to the planner and report commands/s, with and
+   * without PRECOMPILED_GCODE.
+   */
+  //#define PLANNER_BENCHMARK
+#endif
 
 /**
  * Postmortem Debugging captures misbehavior and outputs the CPU status and backtrace to serial.
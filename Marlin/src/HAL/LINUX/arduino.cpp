@@ -24,12 +24,43 @@
 #include <iostream>
 #include "../../inc/MarlinConfig.h"
 #include "hardware/Clock.h"
+#include "hardware/Gpio.h"
 #include "../shared/Delay.h"
 
 // Interrupts
 void cli() { } // Disable
 void sei() { } // Enable
 
+// Pin change interrupts, raised by the simulated hardware through Gpio::set
+class PinInterrupt : public Peripheral {
+public:
+  void (*callback)() = nullptr;
+  uint32_t mode = CHANGE;
+
+  void interrupt(GpioEvent ev) {
+    if (!callback) return;
+    if ( (ev.event == GpioEvent::RISE && mode != FALLING)
+      || (ev.event == GpioEvent::FALL && mode != RISING)
+    ) callback();
+  }
+  void update() {}
+};
+
+static PinInterrupt pin_interrupt[Gpio::pin_count + 1];
+
+void attachInterrupt(uint32_t pin, void (*callback)(), uint32_t mode) {
+  if (!VALID_PIN(pin)) return;
+  pin_interrupt[pin].callback = callback;
+  pin_interrupt[pin].mode = mode;
+  Gpio::attachPeripheral(pin, &pin_interrupt[pin]);
+}
+
+void detachInterrupt(uint32_t pin) {
+  if (!VALID_PIN(pin)) return;
+  pin_interrupt[pin].callback = nullptr;
+  Gpio::attachPeripheral(pin, nullptr);
+}
+
 // Time functions
 void _delay_ms(const int delay_ms) {
   delay(delay_ms);
@@ -55,7 +55,9 @@ void LinearAxis::interrupt(GpioEvent ev) {
     if (ev.event == GpioEvent::RISE) {
       last_update = ev.timestamp;
       position += -1 + 2 * Gpio::pin_map[dir_pin].value;
-      Gpio::pin_map[min_pin].value = (position < min_position);
+      // Raise an edge on the endstop pin, if it changed, for any pin interrupt
+      const bool at_min = (position < min_position);
+      if (Gpio::get(min_pin) != at_min) Gpio::set(min_pin, at_min);
       //Gpio::pin_map[max_pin].value = (position > max_position);
       //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
     }
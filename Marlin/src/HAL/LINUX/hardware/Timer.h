@@ -57,7 +57,7 @@ public:
     _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
     _this->avg_error /= 2; //very crude precision analysis (actually within +-500ns usually)
     _this->start_time = Clock::nanos(); // wrap
-    _this->cbfn();
+    if (_this->active) _this->cbfn(); // All timers share one signal, so a disabled timer can still fire
     _this->overruns += timer_getoverrun(_this->timerid); // even at 50Khz this doesn't stay zero, again demonstrating the limitations
                                                          // using a realtime linux kernel would help somewhat
   }
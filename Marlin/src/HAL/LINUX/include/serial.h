@@ -62,6 +62,15 @@ public:
     return true;
   }
 
+  // The unread data up to the end of the array, for bulk reads
+  uint32_t span(const T **data) volatile {
+    const uint32_t r = mask(index_read);
+    *data = const_cast<const T*>(&buffer[r]);
+    return _MIN(available(), buffer_size - r);
+  }
+
+  void consume(const uint32_t count) volatile { index_read += count; }
+
 private:
   uint32_t mask(uint32_t val) volatile {
     return buffer_mask & val;
@@ -87,6 +96,9 @@ struct HalSerial {
 
   int read() { return receive_buffer.read(); }
 
+  size_t rx_span(const uint8_t **data) { return receive_buffer.span(data); }
+  void rx_consume(const size_t count) { receive_buffer.consume(count); }
+
   size_t write(char c) {
     if (!host_connected) return 0;
     while (!transmit_buffer.free());
@@ -26,6 +26,26 @@
 #include "MarlinSerial.h"
 #include <libmaple/usart.h>
 
+#if ENABLED(SERIAL_DMA_RX)
+
+  // Feed the Emergency Parser with the bytes received by DMA since the last call.
+  // The USART and DMA interrupts may preempt each other, so only one of them scans.
+  static inline void rx_dma_scan(MSerialT &serial) {
+    #if ENABLED(EMERGENCY_PARSER)
+      if (!serial.emergency_parser_enabled() || serial.rx_scanning) return;
+      serial.rx_scanning = true;
+      const uint16_t head = serial.rx_head();
+      for (uint16_t i = serial.rx_scanned; i != head; i = (i + 1) & (RX_BUFFER_SIZE - 1))
+        emergency_parser.update(serial.emergency_state, serial.rx_dma->buf[i]);
+      serial.rx_scanned = head;
+      serial.rx_scanning = false;
+    #else
+      UNUSED(serial);
+    #endif
+  }
+
+#endif
+
 // Copied from ~/.platformio/packages/framework-arduinoststm32-maple/STM32F1/system/libmaple/usart_private.h
 // Changed to handle Emergency Parser
 static inline __always_inline void my_usart_irq(ring_buffer *rb, ring_buffer *wb, usart_reg_map *regs, MSerialT &serial) {
@@ -37,6 +57,15 @@ static inline __always_inline void my_usart_irq(ring_buffer *rb, ring_buffer *wb
   */
   uint32_t srflags = regs->SR, cr1its = regs->CR1;
 
+  #if ENABLED(SERIAL_DMA_RX)
+    // IDLE signifies the end of a burst received by DMA
+    if ((cr1its & USART_CR1_IDLEIE) && (srflags & USART_SR_IDLE)) {
+      regs->DR; // Reading DR after SR clears IDLE
+      rx_dma_scan(serial);
+      srflags &= ~USART_SR_ORE; // The DR read above also cleared ORE
+    }
+  #endif
+
   if ((cr1its & USART_CR1_RXNEIE) && (srflags & USART_SR_RXNE)) {
     if (srflags & USART_SR_FE || srflags & USART_SR_PE ) {
       // framing error or parity error
@@ -90,20 +119,75 @@ constexpr bool serial_handles_emergency(int port) {
   ;
 }
 
+#if ENABLED(SERIAL_DMA_RX)
+
+  // Only host ports receive by DMA, leaving the other DMA channels alone
+  constexpr bool serial_uses_rx_dma(int port) {
+    return false
+      #ifdef SERIAL_PORT
+        || (SERIAL_PORT) == port
+      #endif
+      #ifdef SERIAL_PORT_2
+        || (SERIAL_PORT_2) == port
+      #endif
+      #ifdef SERIAL_PORT_3
+        || (SERIAL_PORT_3) == port
+      #endif
+    ;
+  }
+
+  // USART RX DMA requests. See tables 78 and 79 in RM0008. UART5 has none.
+  #define USART1_RX_DMA DMA1, DMA_CH5
+  #define USART2_RX_DMA DMA1, DMA_CH6
+  #define USART3_RX_DMA DMA1, DMA_CH3
+  #define UART4_RX_DMA  DMA2, DMA_CH3
+
+  #define DEFINE_RX_DMA(n, DMA)              \
+    static uint8_t rx_dma_buf##n[serial_uses_rx_dma(n) ? RX_BUFFER_SIZE : 1]; \
+    static void rx_dma_isr##n();             \
+    static const serial_rx_dma_t rx_dma##n = { rx_dma_buf##n, DMA, rx_dma_isr##n };
+  #define RX_DMA_ARG(n) , (serial_uses_rx_dma(n) ? &rx_dma##n : nullptr)
+  #define RX_DMA_ISR(n) static void rx_dma_isr##n() { rx_dma_scan(MSerial##n); }
+
+#else
+
+  #define DEFINE_RX_DMA(n, DMA)
+  #define RX_DMA_ARG(n)
+  #define RX_DMA_ISR(n)
+
+#endif
+
 #define DEFINE_HWSERIAL_MARLIN(name, n)     \
+  DEFINE_RX_DMA(n, USART##n##_RX_DMA)       \
   MSerialT name(serial_handles_emergency(n),\
             USART##n,                       \
             BOARD_USART##n##_TX_PIN,        \
-            BOARD_USART##n##_RX_PIN);       \
+            BOARD_USART##n##_RX_PIN         \
+            RX_DMA_ARG(n));                 \
+  RX_DMA_ISR(n)                             \
   extern "C" void __irq_usart##n(void) {    \
     my_usart_irq(USART##n->rb, USART##n->wb, USART##n##_BASE, MSerial##n); \
   }
 
 #define DEFINE_HWSERIAL_UART_MARLIN(name, n) \
+  DEFINE_RX_DMA(n, UART##n##_RX_DMA)         \
+  MSerialT name(serial_handles_emergency(n), \
+          UART##n,                           \
+          BOARD_USART##n##_TX_PIN,           \
+          BOARD_USART##n##_RX_PIN            \
+          RX_DMA_ARG(n));                    \
+  RX_DMA_ISR(n)                              \
+  extern "C" void __irq_usart##n(void) {     \
+    my_usart_irq(UART##n->rb, UART##n->wb, UART##n##_BASE, MSerial##n); \
+  }
+
+// A UART without DMA
+#define DEFINE_HWSERIAL_UART_NODMA_MARLIN(name, n) \
   MSerialT name(serial_handles_emergency(n), \
           UART##n,                           \
           BOARD_USART##n##_TX_PIN,           \
-          BOARD_USART##n##_RX_PIN);          \
+          BOARD_USART##n##_RX_PIN            \
+          OPTARG(SERIAL_DMA_RX, nullptr));   \
   extern "C" void __irq_usart##n(void) {     \
     my_usart_irq(UART##n->rb, UART##n->wb, UART##n##_BASE, MSerial##n); \
   }
@@ -118,7 +202,77 @@ DEFINE_HWSERIAL_MARLIN(MSerial2, 2);
 DEFINE_HWSERIAL_MARLIN(MSerial3, 3);
 #if EITHER(STM32_HIGH_DENSITY, STM32_XL_DENSITY)
   DEFINE_HWSERIAL_UART_MARLIN(MSerial4, 4);
-  DEFINE_HWSERIAL_UART_MARLIN(MSerial5, 5);
+  DEFINE_HWSERIAL_UART_NODMA_MARLIN(MSerial5, 5);
+#endif
+
+#if defined(UART_IRQ_PRIO) || ENABLED(SERIAL_DMA_RX)
+
+  void MarlinSerial::begin(uint32 baud, uint8_t config) {
+    HardwareSerial::begin(baud, config);
+    #ifdef UART_IRQ_PRIO
+      nvic_irq_set_priority(c_dev()->irq_num, UART_IRQ_PRIO);
+    #endif
+
+    #if ENABLED(SERIAL_DMA_RX)
+      if (!rx_dma) return;
+      usart_reg_map * const regs = c_dev()->regs;
+      regs->CR1 &= ~USART_CR1_RXNEIE;   // No interrupt per byte
+
+      dma_init(rx_dma->dev);
+      dma_disable(rx_dma->dev, rx_dma->channel);
+      dma_setup_transfer(rx_dma->dev, rx_dma->channel, &regs->DR, DMA_SIZE_8BITS, rx_dma->buf, DMA_SIZE_8BITS,
+        DMA_MINC_MODE | DMA_CIRC_MODE
+        #if ENABLED(EMERGENCY_PARSER)
+          | DMA_HALF_TRNS | DMA_TRNS_CMPLT  // Also scan during bursts longer than the buffer
+        #endif
+      );
+      dma_set_num_transfers(rx_dma->dev, rx_dma->channel, RX_BUFFER_SIZE);
+      dma_set_priority(rx_dma->dev, rx_dma->channel, DMA_PRIORITY_HIGH);
+      #if ENABLED(EMERGENCY_PARSER)
+        dma_attach_interrupt(rx_dma->dev, rx_dma->channel, rx_dma->isr);
+      #endif
+      rx_tail = rx_scanned = 0;
+      dma_enable(rx_dma->dev, rx_dma->channel);
+
+      regs->CR3 |= USART_CR3_DMAR;       // Hand RX over to the DMA
+      regs->CR1 |= USART_CR1_IDLEIE;     // Interrupt at the end of each burst
+    #endif
+  }
+
+#endif
+
+#if ENABLED(SERIAL_DMA_RX)
+
+  int MarlinSerial::available() {
+    if (!rx_dma) return HardwareSerial::available();
+    return (rx_head() - rx_tail) & (RX_BUFFER_SIZE - 1);
+  }
+
+  int MarlinSerial::peek() {
+    if (!rx_dma) return HardwareSerial::peek();
+    return rx_head() != rx_tail ? rx_dma->buf[rx_tail] : -1;
+  }
+
+  int MarlinSerial::read() {
+    if (!rx_dma) return HardwareSerial::read();
+    const uint16_t t = rx_tail;
+    if (rx_head() == t) return -1;
+    const uint8_t c = rx_dma->buf[t];
+    rx_tail = (t + 1) & (RX_BUFFER_SIZE - 1);
+    return c;
+  }
+
+  size_t MarlinSerial::rx_span(const uint8_t **data) {
+    if (!rx_dma) return 0;
+    const uint16_t head = rx_head(), tail = rx_tail;
+    *data = &rx_dma->buf[tail];
+    return (head >= tail ? head : RX_BUFFER_SIZE) - tail;
+  }
+
+  void MarlinSerial::rx_consume(const size_t count) {
+    rx_tail = (rx_tail + count) & (RX_BUFFER_SIZE - 1);
+  }
+
 #endif
 
 // Check the type of each serial port by passing it to a template function.
@@ -23,6 +23,7 @@
 
 #include <HardwareSerial.h>
 #include <libmaple/usart.h>
+#include <libmaple/dma.h>
 #include <WString.h>
 
 #include "../../inc/MarlinConfigPre.h"
@@ -31,19 +32,52 @@
 // Increase priority of serial interrupts, to reduce overflow errors
 #define UART_IRQ_PRIO 1
 
+#if ENABLED(SERIAL_DMA_RX)
+  // A DMA channel and circular buffer to receive into
+  typedef struct {
+    uint8_t *buf;                         // RX_BUFFER_SIZE bytes
+    dma_dev *dev;
+    dma_channel channel;
+    void (*isr)();                        // Half / full transfer handler, for the Emergency Parser
+  } serial_rx_dma_t;
+#endif
+
 struct MarlinSerial : public HardwareSerial {
   MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin) : HardwareSerial(usart_device, tx_pin, rx_pin) { }
 
-  #ifdef UART_IRQ_PRIO
-    // Shadow the parent methods to set IRQ priority after begin()
+  #if ENABLED(SERIAL_DMA_RX)
+    /**
+     * With rx_dma the USART receives into a circular buffer by DMA, with no
+     * interrupt per byte. The IDLE interrupt (and the DMA half / full transfer
+     * interrupts during long bursts) only feed the Emergency Parser.
+     */
+    const serial_rx_dma_t * const rx_dma; // Null to receive by RXNE interrupt
+    volatile uint16_t rx_tail;            // Next byte to read
+    uint16_t rx_scanned;                  // Next byte for the Emergency Parser
+    volatile bool rx_scanning;
+
+    MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin, const serial_rx_dma_t *dma)
+      : HardwareSerial(usart_device, tx_pin, rx_pin), rx_dma(dma), rx_tail(0), rx_scanned(0), rx_scanning(false) { }
+
+    // Index of the next byte the DMA will write
+    inline uint16_t rx_head() const { return RX_BUFFER_SIZE - dma_channel_regs(rx_dma->dev, rx_dma->channel)->CNDTR; }
+
+    int available();
+    int peek();
+    int read();
+
+    // Bulk read: get the contiguous received bytes in place, then consume them
+    size_t rx_span(const uint8_t **data);
+    void rx_consume(const size_t count);
+  #endif
+
+  #if defined(UART_IRQ_PRIO) || ENABLED(SERIAL_DMA_RX)
+    // Shadow the parent methods to set IRQ priority and start DMA after begin()
     void begin(uint32 baud) {
       MarlinSerial::begin(baud, SERIAL_8N1);
     }
 
-    void begin(uint32 baud, uint8_t config) {
-      HardwareSerial::begin(baud, config);
-      nvic_irq_set_priority(c_dev()->irq_num, UART_IRQ_PRIO);
-    }
+    void begin(uint32 baud, uint8_t config);
   #endif
 };
 
@@ -50,7 +50,7 @@
 #include "../../module/endstops.h"
 
 // One ISR for all EXT-Interrupts
-void endstop_ISR() { endstops.update(); }
+void endstop_ISR() { TERN(ENDSTOP_EDGE_TIMESTAMPS, endstops.edge_update(), endstops.update()); }
 
 void setup_endstop_interrupts() {
   #define _ATTACH(P) attachInterrupt(P, endstop_ISR, CHANGE)
@@ -39,6 +39,10 @@
   #error "SERIAL_STATS_DROPPED_RX is not supported on the STM32F1 platform."
 #endif
 
+#if ENABLED(SERIAL_DMA_RX) && RX_BUFFER_SIZE < 64
+  #error "SERIAL_DMA_RX requires RX_BUFFER_SIZE >= 64."
+#endif
+
 #if ENABLED(NEOPIXEL_LED) && DISABLED(MKS_MINI_12864_V3)
   #error "NEOPIXEL_LED (Adafruit NeoPixel) is not supported for HAL/STM32F1. Comment out this line to proceed at your own risk!"
 #endif
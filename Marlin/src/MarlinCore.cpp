@@ -236,6 +236,14 @@
   #include "feature/stepper_driver_safety.h"
 #endif
 
+#if ENABLED(SEGMENT_MERGING)
+  #include "feature/segment_merge.h"
+#endif
+
+#if ENABLED(CORNER_BLENDING)
+  #include "feature/corner_blend.h"
+#endif
+
 PGMSTR(M112_KILL_STR, "M112 Shutdown");
 
 MarlinState marlin_state = MF_INITIALIZING;
@@ -770,6 +778,7 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
  *  - Max7219 heartbeat, animation, etc.
  *
  *  Only after setup() is complete:
+ *  - Precompute step timing for upcoming blocks
  *  - Handle filament runout sensors
  *  - Run HAL idle tasks
  *  - Handle Power-Loss Recovery
@@ -803,6 +812,9 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) goto IDLE_DONE;
 
+  // Precompute step timing for the Stepper ISR
+  TERN_(STEP_TIMING_TABLE, stepper.prepare_step_timing());
+
   // TODO: Still causing errors
   (void)check_tool_sensor_stats(active_extruder, true);
 
@@ -1283,7 +1295,7 @@ void setup() {
     );
   #endif
   SERIAL_ECHO_MSG("Compiled: " __DATE__);
-  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, sizeof(block_t) * (BLOCK_BUFFER_SIZE));
+  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, (sizeof(block_t) + sizeof(block_plan_t)) * (BLOCK_BUFFER_SIZE));
 
   // Some HAL need precise delay adjustment
   calibrate_delay_loop();
@@ -1656,6 +1668,9 @@ void loop() {
 
     queue.advance();
 
+    TERN_(SEGMENT_MERGING, segment_merge.task());
+    TERN_(CORNER_BLENDING, corner_blend.task());
+
     endstops.event_handler();
 
     TERN_(HAS_TFT_LVGL_UI, printer_state_polling());
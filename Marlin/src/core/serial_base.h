@@ -69,6 +69,8 @@ ENUM_FLAGS(SerialFeature);
 CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
+CALL_IF_EXISTS_IMPL(size_t, rx_span, 0);
+CALL_IF_EXISTS_IMPL(void, rx_consume);
 
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
@@ -119,6 +121,17 @@ struct SerialBase {
       @param index  The port index, usually 0 */
   int read(serial_index_t index=0)        { return SerialChild->read(index); }
 
+  /** Get the received data that can be read in place, for a bulk read
+      @param index  The port index, usually 0
+      @param data   Set to the first unread byte
+      @return       The number of contiguous unread bytes at data. 0 if none, or if the port can't do bulk reads. */
+  size_t rx_span(serial_index_t index, const uint8_t **data) { return SerialChild->rx_span(index, data); }
+
+  /** Mark bytes from rx_span as read
+      @param index  The port index, usually 0
+      @param count  The number of bytes read */
+  void rx_consume(serial_index_t index, const size_t count) { SerialChild->rx_consume(index, count); }
+
   /** Combine the features of this serial instance and return it
       @param index  The port index, usually 0 */
   SerialFeature features(serial_index_t index=0) const { return static_cast<const Child*>(this)->features(index);  }
@@ -36,29 +36,63 @@
 
 Babystep babystep;
 
-volatile int16_t Babystep::steps[BS_AXIS_IND(Z_AXIS) + 1];
+#if ENABLED(BABYSTEP_SMOOTHING)
+  volatile int32_t Babystep::queued[BS_AXIS_IND(Z_AXIS) + 1], Babystep::done[BS_AXIS_IND(Z_AXIS) + 1];
+#else
+  volatile int16_t Babystep::steps[BS_AXIS_IND(Z_AXIS) + 1];
+#endif
 #if ENABLED(BABYSTEP_DISPLAY_TOTAL)
   int16_t Babystep::axis_total[BS_TOTAL_IND(Z_AXIS) + 1];
 #endif
 int16_t Babystep::accum;
 
-void Babystep::step_axis(const AxisEnum axis) {
-  const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
-  if (curTodo) {
-    stepper.do_babystep((AxisEnum)axis, curTodo > 0);
-    if (curTodo > 0) steps[BS_AXIS_IND(axis)]--; else steps[BS_AXIS_IND(axis)]++;
+#if ENABLED(BABYSTEP_SMOOTHING)
+
+  void Babystep::step_axis(const AxisEnum axis) {
+    const int32_t curTodo = pending(BS_AXIS_IND(axis));
+    if (curTodo) {
+      stepper.do_babystep((AxisEnum)axis, curTodo > 0);
+      done[BS_AXIS_IND(axis)] += curTodo > 0 ? 1 : -1;
+    }
   }
-}
 
-void Babystep::add_mm(const AxisEnum axis, const_float_t mm) {
-  add_steps(axis, mm * planner.settings.axis_steps_per_mm[axis]);
-}
+  uint32_t Babystep::next_interval() {
+    uint32_t most = 0;
+    LOOP_LE_N(i, BS_AXIS_IND(Z_AXIS)) NOLESS(most, uint32_t(ABS(pending(i))));
+    if (!most) return 0;
+    return _MAX(BABYSTEP_SMOOTH_TICKS / most, uint32_t(BABYSTEP_TICKS));
+  }
+
+  // Keep the fraction of a step for the next adjustment
+  void Babystep::add_mm(const AxisEnum axis, const_float_t mm) {
+    static float residual[BS_AXIS_IND(Z_AXIS) + 1];
+    const float total = mm * planner.settings.axis_steps_per_mm[axis] + residual[BS_AXIS_IND(axis)];
+    const int16_t whole = int16_t(total);
+    residual[BS_AXIS_IND(axis)] = total - whole;
+    add_steps(axis, whole);
+  }
+
+#else
+
+  void Babystep::step_axis(const AxisEnum axis) {
+    const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
+    if (curTodo) {
+      stepper.do_babystep((AxisEnum)axis, curTodo > 0);
+      if (curTodo > 0) steps[BS_AXIS_IND(axis)]--; else steps[BS_AXIS_IND(axis)]++;
+    }
+  }
+
+  void Babystep::add_mm(const AxisEnum axis, const_float_t mm) {
+    add_steps(axis, mm * planner.settings.axis_steps_per_mm[axis]);
+  }
+
+#endif
 
 void Babystep::add_steps(const AxisEnum axis, const int16_t distance) {
   if (DISABLED(BABYSTEP_WITHOUT_HOMING) && axes_should_home(_BV(axis))) return;
 
   accum += distance; // Count up babysteps for the UI
-  steps[BS_AXIS_IND(axis)] += distance;
+  TERN(BABYSTEP_SMOOTHING, queued, steps)[BS_AXIS_IND(axis)] += distance;
   TERN_(BABYSTEP_DISPLAY_TOTAL, axis_total[BS_TOTAL_IND(axis)] += distance);
   TERN_(BABYSTEP_ALWAYS_AVAILABLE, gcode.reset_stepper_timeout());
   TERN_(INTEGRATED_BABYSTEPPING, if (has_steps()) stepper.initiateBabystepping());
@@ -31,6 +31,10 @@
   #define BABYSTEP_TICKS ((TEMP_TIMER_RATE) / (BABYSTEPS_PER_SEC))
 #endif
 
+#if ENABLED(BABYSTEP_SMOOTHING)
+  #define BABYSTEP_SMOOTH_TICKS uint32_t((BABYSTEP_SMOOTH_TIME) * (STEPPER_TIMER_RATE))
+#endif
+
 #if IS_CORE || EITHER(BABYSTEP_XY, I2C_POSITION_ENCODERS)
   #define BS_AXIS_IND(A) A
   #define BS_AXIS(I) AxisEnum(I)
@@ -49,7 +53,14 @@
 
 class Babystep {
 public:
-  static volatile int16_t steps[BS_AXIS_IND(Z_AXIS) + 1];
+  #if ENABLED(BABYSTEP_SMOOTHING)
+    // Lock-free single producer / single consumer: add_steps only writes 'queued'
+    // and the Stepper ISR only writes 'done', so neither needs to block the other.
+    static volatile int32_t queued[BS_AXIS_IND(Z_AXIS) + 1], done[BS_AXIS_IND(Z_AXIS) + 1];
+    static inline int32_t pending(const uint8_t i) { return queued[i] - done[i]; }
+  #else
+    static volatile int16_t steps[BS_AXIS_IND(Z_AXIS) + 1];
+  #endif
   static int16_t accum;                                     // Total babysteps in current edit
 
   #if ENABLED(BABYSTEP_DISPLAY_TOTAL)
@@ -64,9 +75,18 @@ public:
   static void add_mm(const AxisEnum axis, const_float_t mm);
 
   static inline bool has_steps() {
-    return steps[BS_AXIS_IND(X_AXIS)] || steps[BS_AXIS_IND(Y_AXIS)] || steps[BS_AXIS_IND(Z_AXIS)];
+    #if ENABLED(BABYSTEP_SMOOTHING)
+      return pending(BS_AXIS_IND(X_AXIS)) || pending(BS_AXIS_IND(Y_AXIS)) || pending(BS_AXIS_IND(Z_AXIS));
+    #else
+      return steps[BS_AXIS_IND(X_AXIS)] || steps[BS_AXIS_IND(Y_AXIS)] || steps[BS_AXIS_IND(Z_AXIS)];
+    #endif
   }
 
+  #if ENABLED(BABYSTEP_SMOOTHING)
+    // Ticks until the next babystep, or 0 if none. The queue drains at a rate proportional to its size.
+    static uint32_t next_interval();
+  #endif
+
   //
   // Called by the Temperature or Stepper ISR to
   // apply accumulated babysteps to the axes.
@@ -58,6 +58,10 @@ Backlash backlash;
  *
  * With a non-zero BACKLASH_SMOOTHING_MM value the backlash correction is
  * spread over multiple segments, smoothing out artifacts even more.
+ *
+ * With BACKLASH_STREAM the steps aren't added to the segment at all. The
+ * Stepper issues them at BACKLASH_STREAM_RATE as the segment starts, so the
+ * segment keeps its own trapezoid and E ratio.
  */
 
 void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const int32_t &dc, const uint8_t dm, block_t * const block) {
@@ -119,7 +123,7 @@ void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const
           // Take up a portion of the residual_error in this segment, but only when
           // the current segment travels in the same direction as the correction
           if (reversing == (error_correction < 0)) {
-            if (segment_proportion == 0) segment_proportion = _MIN(1.0f, block->millimeters / smoothing_mm);
+            if (segment_proportion == 0) segment_proportion = _MIN(1.0f, planner.plan_of(block).millimeters / smoothing_mm);
             error_correction = CEIL(segment_proportion * error_correction);
           }
           else
@@ -128,8 +132,9 @@ void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const
       #endif
 
       // This correction reduces the residual error and adds block steps
+      // (or, with BACKLASH_STREAM, takeup steps issued alongside the block)
       if (error_correction) {
-        block->steps[axis] += ABS(error_correction);
+        TERN(BACKLASH_STREAM, block->backlash_steps, block->steps)[axis] += ABS(error_correction);
         #if ENABLED(CORE_BACKLASH)
           switch (axis) {
             case CORE_AXIS_1:
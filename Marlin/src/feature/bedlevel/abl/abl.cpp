@@ -244,10 +244,86 @@ void print_bilinear_leveling_grid() {
   }
 #endif // ABL_BILINEAR_SUBDIVISION
 
+#if ENABLED(ABL_BICUBIC)
+
+  // Slopes at each grid point, in Z per grid cell
+  static bed_mesh_t z_dx, z_dy, z_dxy;
+
+  // Polynomial coefficients of the last cell used, by powers of X then Y
+  static float bicubic_coeff[4][4];
+  static xy_int8_t bicubic_cell { -1, -1 };
+
+  /**
+   * Get the slopes for the Catmull-Rom patches from the grid: central differences,
+   * or one-sided at the edges where the grid is extended linearly. This gives the
+   * same surface as the ABL_BILINEAR_SUBDIVISION virtual grid points.
+   */
+  void bed_level_bicubic_refresh() {
+    GRID_LOOP(x, y) {
+      const uint8_t x0 = x ? x - 1 : x, x1 = _MIN(x + 1, (GRID_MAX_POINTS_X) - 1),
+                    y0 = y ? y - 1 : y, y1 = _MIN(y + 1, (GRID_MAX_POINTS_Y) - 1);
+      z_dx[x][y] = (z_values[x1][y] - z_values[x0][y]) / float(x1 - x0);
+      z_dy[x][y] = (z_values[x][y1] - z_values[x][y0]) / float(y1 - y0);
+    }
+    GRID_LOOP(x, y) {
+      const uint8_t y0 = y ? y - 1 : y, y1 = _MIN(y + 1, (GRID_MAX_POINTS_Y) - 1);
+      z_dxy[x][y] = (z_dx[x][y1] - z_dx[x][y0]) / float(y1 - y0);
+    }
+    bicubic_cell.set(-1, -1);
+  }
+
+  // Replace the values and slopes at 0 and 1 with the coefficients of the Hermite cubic
+  static void bicubic_hermite(float &v0, float &v1, float &d0, float &d1) {
+    const float a = v0, b = v1, da = d0, db = d1;
+    v1 = da;
+    d0 = 3 * (b - a) - 2 * da - db;
+    d1 = 2 * (a - b) + da + db;
+  }
+
+  static float bicubic_z_offset(const xy_pos_t &raw) {
+    xy_float_t ratio = (raw - bilinear_start) * bilinear_grid_factor;
+    const xy_int8_t cell = {
+      int8_t(constrain(FLOOR(ratio.x), 0, GRID_MAX_CELLS_X - 1)),
+      int8_t(constrain(FLOOR(ratio.y), 0, GRID_MAX_CELLS_Y - 1))
+    };
+    ratio.x -= cell.x;
+    ratio.y -= cell.y;
+
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Beyond the grid maintain height at grid edges
+      LIMIT(ratio.x, 0, 1);
+      LIMIT(ratio.y, 0, 1);
+    #endif
+
+    if (cell != bicubic_cell) {
+      bicubic_cell = cell;
+      const uint8_t x0 = cell.x, x1 = x0 + 1, y0 = cell.y, y1 = y0 + 1;
+      float (&c)[4][4] = bicubic_coeff;
+      // Values and slopes at the corners: Z, dZ/dx in rows 0-3, and dZ/dy, d2Z/dxdy in columns 2-3
+      c[0][0] = z_values[x0][y0]; c[0][1] = z_values[x0][y1]; c[0][2] = z_dy[x0][y0];  c[0][3] = z_dy[x0][y1];
+      c[1][0] = z_values[x1][y0]; c[1][1] = z_values[x1][y1]; c[1][2] = z_dy[x1][y0];  c[1][3] = z_dy[x1][y1];
+      c[2][0] = z_dx[x0][y0];     c[2][1] = z_dx[x0][y1];     c[2][2] = z_dxy[x0][y0]; c[2][3] = z_dxy[x0][y1];
+      c[3][0] = z_dx[x1][y0];     c[3][1] = z_dx[x1][y1];     c[3][2] = z_dxy[x1][y0]; c[3][3] = z_dxy[x1][y1];
+      LOOP_L_N(j, 4) bicubic_hermite(c[0][j], c[1][j], c[2][j], c[3][j]);
+      LOOP_L_N(i, 4) bicubic_hermite(c[i][0], c[i][1], c[i][2], c[i][3]);
+    }
+
+    // Horner's method in Y for each power of X, then in X
+    float z = 0;
+    for (int8_t i = 3; i >= 0; i--) {
+      const float * const c = bicubic_coeff[i];
+      z = z * ratio.x + ((c[3] * ratio.y + c[2]) * ratio.y + c[1]) * ratio.y + c[0];
+    }
+    return z;
+  }
+
+#endif // ABL_BICUBIC
+
 // Refresh after other values have been updated
 void refresh_bed_level() {
   bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
   TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  TERN_(ABL_BICUBIC, bed_level_bicubic_refresh());
 }
 
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
@@ -267,6 +343,10 @@ void refresh_bed_level() {
 // Get the Z adjustment for non-linear bed leveling
 float bilinear_z_offset(const xy_pos_t &raw) {
 
+  #if ENABLED(ABL_BICUBIC)
+    return bicubic_z_offset(raw);
+  #endif
+
   static float z1, d2, z3, d4, L, D;
 
   static xy_pos_t prev { -999.999, -999.999 }, ratio;
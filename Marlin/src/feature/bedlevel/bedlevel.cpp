@@ -82,6 +82,7 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
     }
     else {                              // leveling from off to on
       if (DEBUGGING(LEVELING)) DEBUG_POS("Leveling OFF", current_position);
+      TERN_(UBL_CELL_CACHE, ubl.refresh_cells()); // In case the mesh was edited directly
       planner.leveling_active = true;   // enable BEFORE calling unapply_leveling, otherwise ignored
       // change physical current_position to unleveled current_position without moving steppers.
       planner.unapply_leveling(current_position);
@@ -67,6 +67,10 @@ int8_t unified_bed_leveling::storage_slot;
 
 float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+#if ENABLED(UBL_CELL_CACHE)
+  unified_bed_leveling::cell_coeff_t unified_bed_leveling::cells[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y];
+#endif
+
 #define _GRIDPOS(A,N) (MESH_MIN_##A + N * (MESH_##A##_DIST))
 
 const float
@@ -92,6 +96,7 @@ void unified_bed_leveling::reset() {
   set_bed_leveling_enabled(false);
   storage_slot = -1;
   ZERO(z_values);
+  TERN_(UBL_CELL_CACHE, refresh_cells());
   #if ENABLED(EXTENSIBLE_UI)
     GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
   #endif
@@ -108,8 +113,26 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     z_values[x][y] = value;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
   }
+  TERN_(UBL_CELL_CACHE, refresh_cells());
 }
 
+#if ENABLED(UBL_CELL_CACHE)
+
+  void unified_bed_leveling::refresh_cells() {
+    auto zval = [](const uint8_t x, const uint8_t y) { const float z = z_values[x][y]; return isnan(z) ? 0.0f : z; };
+    LOOP_L_N(x, GRID_MAX_CELLS_X) LOOP_L_N(y, GRID_MAX_CELLS_Y) {
+      const float z00 = zval(x, y), z10 = zval(x + 1, y),
+                  z01 = zval(x, y + 1), z11 = zval(x + 1, y + 1);
+      cell_coeff_t &c = cells[x][y];
+      c.a = z00;
+      c.b = (z10 - z00) * RECIPROCAL(MESH_X_DIST);
+      c.c = (z01 - z00) * RECIPROCAL(MESH_Y_DIST);
+      c.d = (z11 - z10 - z01 + z00) * RECIPROCAL((MESH_X_DIST) * (MESH_Y_DIST));
+    }
+  }
+
+#endif
+
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
 
   constexpr float mesh_store_scaling = 1000;
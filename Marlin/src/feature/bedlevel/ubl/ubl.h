@@ -294,6 +294,47 @@ public:
     return i < (GRID_MAX_POINTS_Y) ? pgm_read_float(&_mesh_index_to_ypos[i]) : MESH_MIN_Y + i * (MESH_Y_DIST);
   }
 
+  #if ENABLED(UBL_CELL_CACHE)
+    /**
+     * Bilinear coefficients of each mesh cell, from refresh_cells(). With u, v
+     * the offset in mm from the cell's front-left mesh point, the correction is
+     * z = a + b * u + (c + d * u) * v. Undefined mesh points count as 0.
+     */
+    typedef struct { float a, b, c, d; } cell_coeff_t;
+    static cell_coeff_t cells[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y];
+
+    // Update the cell coefficients after the mesh changes
+    static void refresh_cells();
+
+    /**
+     * Follow a segmented line across the mesh cells. Past the edge of the mesh
+     * the outer cells are extended, like get_z_correction does.
+     */
+    struct cell_walker_t {
+      xy_int8_t icell;                      // The current cell
+      xy_pos_t pos;                         // Position within the cell
+
+      void start(const xy_pos_t &xy) {
+        icell = cell_indexes(xy);
+        pos.set(xy.x - mesh_index_to_xpos(icell.x), xy.y - mesh_index_to_ypos(icell.y));
+      }
+
+      // Move by 'd', stepping into the neighboring cells as they're crossed
+      void advance(const xy_float_t &d) {
+        pos += d;
+        while (pos.x < 0 && icell.x > 0)                                  { icell.x--; pos.x += MESH_X_DIST; }
+        while (pos.x > MESH_X_DIST && icell.x < GRID_MAX_CELLS_X - 1)     { icell.x++; pos.x -= MESH_X_DIST; }
+        while (pos.y < 0 && icell.y > 0)                                  { icell.y--; pos.y += MESH_Y_DIST; }
+        while (pos.y > MESH_Y_DIST && icell.y < GRID_MAX_CELLS_Y - 1)     { icell.y++; pos.y -= MESH_Y_DIST; }
+      }
+
+      float z() const {
+        const cell_coeff_t &c = cells[icell.x][icell.y];
+        return c.a + c.b * pos.x + (c.c + c.d * pos.x) * pos.y;
+      }
+    };
+  #endif
+
   #if UBL_SEGMENTED
     static bool line_to_destination_segmented(const_feedRate_t scaled_fr_mm_s);
   #else
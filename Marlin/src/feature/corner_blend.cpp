@@ -0,0 +1,151 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * corner_blend.cpp - Round the corners between straight moves (G64)
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CORNER_BLENDING)
+
+#include "corner_blend.h"
+
+CornerBlend corner_blend;
+
+float CornerBlend::tolerance = CORNER_BLENDING_TOLERANCE;
+bool CornerBlend::valid, CornerBlend::held, CornerBlend::busy; // = false
+xyze_pos_t CornerBlend::start, CornerBlend::end;
+feedRate_t CornerBlend::held_fr_mm_s;
+uint8_t CornerBlend::held_extruder;
+
+// Queue a move into the planner, forgetting the path if it's dropped
+bool CornerBlend::emit(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder) {
+  if (planner._buffer_line(target, fr_mm_s, extruder)) return true;
+  held = valid = false;
+  return false;
+}
+
+void CornerBlend::flush() {
+  if (!held || busy) return;
+  busy = true;
+  held = false;
+  emit(end, held_fr_mm_s, held_extruder);
+  busy = false;
+}
+
+bool CornerBlend::add(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder) {
+  const xyz_pos_t d2 = xyz_pos_t(target) - xyz_pos_t(end);
+  const float L2 = d2.magnitude();
+
+  // Exact corners, an unknown start, or no XYZ motion: Queue the move as-is
+  if (!tolerance || !valid || L2 < 0.001f) {
+    flush();
+    busy = true;
+    valid = emit(target, fr_mm_s, extruder);
+    busy = false;
+    end = target;
+    return valid;
+  }
+
+  // Hold the first move until the next one shows the corner
+  if (!held) {
+    start = end;
+    end = target;
+    held_fr_mm_s = fr_mm_s;
+    held_extruder = extruder;
+    held = true;
+    return true;
+  }
+
+  busy = true;
+
+  const xyz_pos_t d1 = xyz_pos_t(end) - xyz_pos_t(start);
+  const float L1 = d1.magnitude();
+  const xyz_pos_t u1 = d1 / L1, u2 = d2 / L2;
+  const float cos_t = u1.x * u2.x + u1.y * u2.y + u1.z * u2.z,
+              de1 = end.e - start.e, de2 = target.e - end.e;
+
+  // Only blend between two printing moves or two travel moves, deflected by 0.5° to 170°
+  bool blended = false, ok = true;
+  if (extruder == held_extruder && (de1 > 0) == (de2 > 0) && (de1 < 0) == (de2 < 0)
+    && WITHIN(cos_t, -0.98481f, 0.99996f)
+  ) {
+    constexpr float max_angle = RADIANS(CORNER_BLENDING_MAX_ANGLE);
+    const float theta = ACOS(cos_t), half = theta * 0.5f;
+    const uint8_t chords = CEIL(theta / max_angle);
+
+    // An arc of radius R cuts the corner t from its vertex. Its inscribed
+    // chords come closest to the vertex, so fit those to the tolerance.
+    float R = tolerance / (1.0f / cos(half) - cos(half / chords)),
+          t = R * tan(half);
+    NOMORE(t, L1);          // Keep the held move's start, already blended
+    NOMORE(t, 0.5f * L2);   // Leave half of the new move for the next corner
+    if (t > 0.001f) {
+      R = t / tan(half);
+      blended = true;
+
+      const feedRate_t arc_fr = _MIN(held_fr_mm_s, fr_mm_s);
+      xyze_pos_t p1 = end, p2 = end;
+      LOOP_LINEAR_AXES(i) { p1[i] -= u1[i] * t; p2[i] += u2[i] * t; }
+      p1.e = start.e + de1 * (L1 - t) / L1;
+      p2.e = end.e + de2 * t / L2;
+
+      // Straight part of the held move
+      if (L1 - t > 0.001f) ok = emit(p1, held_fr_mm_s, held_extruder);
+
+      // Chords of the arc from p1 to p2, with E proportional to arc length
+      xyz_pos_t center = u2 - u1;
+      center *= R / (cos(half) * center.magnitude());
+      center += xyz_pos_t(end);
+      const xyz_pos_t v1 = xyz_pos_t(p1) - center, v2 = xyz_pos_t(p2) - center;
+      const float inv_sin = 1.0f / sin(theta);
+      for (uint8_t c = 1; ok && c <= chords; ++c) {
+        xyze_pos_t p = p2;
+        if (c < chords) {
+          const float s = float(c) / chords,
+                      w1 = sin((1.0f - s) * theta) * inv_sin, w2 = sin(s * theta) * inv_sin;
+          LOOP_LINEAR_AXES(i) p[i] = center[i] + v1[i] * w1 + v2[i] * w2;
+          p.e = p1.e + (p2.e - p1.e) * s;
+        }
+        ok = emit(p, arc_fr, extruder);
+      }
+
+      start = p2;
+    }
+  }
+
+  if (!blended) {
+    ok = emit(end, held_fr_mm_s, held_extruder);
+    start = end;
+  }
+
+  // Hold the new move for the next corner
+  end = target;
+  held_fr_mm_s = fr_mm_s;
+  held_extruder = extruder;
+  held = ok;
+  busy = false;
+  return ok;
+}
+
+#endif // CORNER_BLENDING
@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * corner_blend.h - Round the corners between straight moves (G64 P<tolerance>)
+ *
+ * The last move is held back until the next one arrives. The corner between them
+ * is then cut with a short circular arc, made of a few chords, that stays within
+ * the path tolerance. The planner sees gentler junctions, so tessellated curves
+ * keep a higher speed through every vertex.
+ */
+
+#include "../module/planner.h"
+
+class CornerBlend {
+public:
+  static float tolerance;                     // Maximum distance from the corner, in mm (0 = exact corners)
+
+  // Add a move ahead of the planner. Return false if it was dropped.
+  static bool add(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder);
+
+  // Queue the held move, if any
+  static void flush();
+
+  // Flush before the planner position is changed or moves bypass the blending
+  static inline void reset() { if (!busy) { flush(); valid = false; } }
+
+  // Flush before the E position is changed (i.e., G92 E0), keeping the path
+  static inline void set_e(const_float_t e) { if (!busy) { flush(); end.e = e; } }
+
+  // Forget the held move after a quick stop
+  static inline void discard() { held = valid = false; }
+
+  // Don't let the planner run dry while holding a move. Called from the main loop.
+  static inline void task() { if (held && !busy && planner.movesplanned() < 2) flush(); }
+
+private:
+  static bool valid,                          // The end of the last move is known
+              held,                           // A move is waiting for the next one
+              busy;                           // Queuing moves into the planner
+  static xyze_pos_t start, end;               // The held move, or 'end' of the last move
+  static feedRate_t held_fr_mm_s;
+  static uint8_t held_extruder;
+
+  static bool emit(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder);
+};
+
+extern CornerBlend corner_blend;
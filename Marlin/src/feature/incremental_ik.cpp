@@ -0,0 +1,136 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * incremental_ik.cpp - Interpolated inverse kinematics for segmented moves
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(INCREMENTAL_IK)
+
+#include "incremental_ik.h"
+#include "../module/motion.h"
+
+IncrementalIK incremental_ik;
+
+// Solve a span exactly if its parabola misses the check knot by more than this
+#define IK_CHECK_STEPS 1.0f
+
+xyze_pos_t IncrementalIK::start;
+xyze_float_t IncrementalIK::step;
+uint16_t IncrementalIK::segments, IncrementalIK::index, IncrementalIK::left,
+         IncrementalIK::knot, IncrementalIK::last_knot, IncrementalIK::solved;
+bool IncrementalIK::exact;
+xyz_pos_t IncrementalIK::knots[8];
+xyz_float_t IncrementalIK::value, IncrementalIK::d1, IncrementalIK::d2;
+
+bool IncrementalIK::begin(const xyze_pos_t &in_start, const xyze_float_t &in_step, const uint16_t in_segments) {
+  // The first span needs the three knots after it
+  if (in_segments < 3 * (INCREMENTAL_IK_SPAN)) return false;
+  start = in_start;
+  step = in_step;
+  segments = in_segments;
+  last_knot = (segments + (INCREMENTAL_IK_SPAN) - 1) / (INCREMENTAL_IK_SPAN);
+  index = left = knot = 0;
+  solve(0, knot_pos(0));
+  solved = 0;
+  return true;
+}
+
+void IncrementalIK::solve(const uint16_t i, xyz_pos_t &joints) {
+  xyze_pos_t machine = start + step * float(i);
+  TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(machine));
+  inverse_kinematics(machine);
+  joints = delta;
+}
+
+// Solve the knots up to 'k', each one only once
+void IncrementalIK::solve_knots(const uint16_t k) {
+  while (solved < k) { solved++; solve(knot_index(solved), knot_pos(solved)); }
+}
+
+/**
+ * Fit P(s) = K0 + B * s + C * s^2 through the knots at the start and the end
+ * of the span, and the knot before the span (or the knot after next in the
+ * first span). Stepping by one segment, P advances by d1 and d1 advances by
+ * d2 = 2C. Another knot two spans away tells how good the fit is. Within the
+ * span the error is about 1/15 of the miss there.
+ */
+void IncrementalIK::start_span() {
+  const uint16_t s0 = knot_index(knot);
+  const int16_t span = knot_index(knot + 1) - s0;
+
+  uint16_t third, check;
+  if (knot) {
+    third = knot - 1;
+    check = knot + 2 <= last_knot ? knot + 2 : knot - 2;
+  }
+  else {
+    third = 2;
+    check = 3;
+  }
+  solve_knots(_MAX(third, check, uint16_t(knot + 1)));
+
+  const xyz_pos_t &k0 = knot_pos(knot), &k1 = knot_pos(knot + 1), &kt = knot_pos(third), &kc = knot_pos(check);
+  const int16_t st = knot_index(third) - s0;
+  const float sc = int16_t(knot_index(check) - s0),
+              r1 = 1.0f / span, rt = 1.0f / st, r1t = 1.0f / (st - span);
+
+  exact = false;
+  LOOP_LINEAR_AXES(a) {
+    const float g1 = (k1[a] - k0[a]) * r1,
+                gt = (kt[a] - k0[a]) * rt,
+                C = (gt - g1) * r1t,
+                B = g1 - C * span;
+    if (ABS(k0[a] + (B + C * sc) * sc - kc[a]) * planner.settings.axis_steps_per_mm[a] > IK_CHECK_STEPS) exact = true;
+    value[a] = k0[a];
+    d1[a] = B + C;
+    d2[a] = 2 * C;
+  }
+
+  left = span;
+}
+
+void IncrementalIK::next(abce_pos_t &joints) {
+  if (!left) start_span();
+  index++;
+
+  if (--left) {
+    if (exact) {
+      xyz_pos_t j;
+      solve(index, j);
+      joints = j;
+    }
+    else {
+      value += d1;
+      d1 += d2;
+      joints = value;
+    }
+  }
+  else {
+    // Land exactly on the knot at the end of the span
+    joints = knot_pos(++knot);
+  }
+}
+
+#endif // INCREMENTAL_IK
@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * incremental_ik.h - Interpolated inverse kinematics for segmented moves
+ *
+ * Delta and SCARA split each straight move into short segments, and every
+ * segment needs the joint positions from inverse_kinematics(). Here the exact
+ * IK is only done at "knots" every INCREMENTAL_IK_SPAN segments. In between,
+ * the joints follow the parabola through three neighboring knots, stepped by
+ * forward differences with a few additions per segment. Each knot is exact,
+ * so the error can't build up over a long move. A fourth knot checks the fit,
+ * and spans where it misses (near the edge of a Delta, a SCARA angle wrapping
+ * around) are solved exactly.
+ */
+
+#include "../module/planner.h"
+
+class IncrementalIK {
+public:
+  // Start a move of 'segments' segments from 'start' by 'step' per segment. Return false if it's too short to interpolate.
+  static bool begin(const xyze_pos_t &start, const xyze_float_t &step, const uint16_t segments);
+
+  // Get the joint positions at the end of the next segment
+  static void next(abce_pos_t &joints);
+
+  // Exact joint positions at the end of segment 'i', with the planner's position modifiers applied
+  static void solve(const uint16_t i, xyz_pos_t &joints);
+
+private:
+  static xyze_pos_t start;
+  static xyze_float_t step;
+  static uint16_t segments, index, left,      // Segments in the move, done so far, and left in this span
+                  knot, last_knot, solved;    // Knot at the start of this span, the final knot, and the last one solved
+  static bool exact;                          // Solve every segment of this span
+  static xyz_pos_t knots[8];                  // Solved knots, indexed by knot number (mod 8)
+  static xyz_float_t value, d1, d2;           // Interpolated joints and their forward differences
+
+  // Segment index of a knot
+  static uint16_t knot_index(const uint16_t k) { return _MIN(k * uint16_t(INCREMENTAL_IK_SPAN), segments); }
+  static xyz_pos_t& knot_pos(const uint16_t k) { return knots[k & 7]; }
+  static void solve_knots(const uint16_t k);
+  static void start_span();
+};
+
+extern IncrementalIK incremental_ik;
@@ -171,5 +171,9 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   int available()                 { return available(0); }
   int read()                      { return readImpl(0); }
 
+  // Packed data must be decoded byte by byte, so no bulk reads
+  size_t rx_span(serial_index_t, const uint8_t**) { return 0; }
+  void rx_consume(serial_index_t, const size_t)   {}
+
   MeatpackSerial(const bool e, SerialT & out) : BaseClassT(e), out(out) {}
 };
@@ -0,0 +1,499 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * planner_bench.cpp - Headless planner throughput benchmark (D110)
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_BENCHMARK)
+
+#include "planner_bench.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../module/motion.h"
+#include "../module/temperature.h"
+#include "../gcode/parser.h"
+#include "../gcode/gcode.h"
+#include "../MarlinCore.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+#if ENABLED(INCREMENTAL_IK)
+  #include "incremental_ik.h"
+#endif
+
+#if ENABLED(UBL_CELL_CACHE)
+  #include "bedlevel/bedlevel.h"
+#endif
+
+PlannerBench planner_bench;
+
+bool PlannerBench::active; // = false
+cycle_stats_t PlannerBench::stats[SECTION_COUNT];
+uint32_t PlannerBench::counters[COUNTER_COUNT];
+uint32_t PlannerBench::moves_fed, PlannerBench::blocks_drained;
+
+void PlannerBench::reset() {
+  LOOP_L_N(i, SECTION_COUNT) stats[i].reset();
+  LOOP_L_N(i, COUNTER_COUNT) counters[i] = 0;
+  moves_fed = blocks_drained = 0;
+}
+
+/**
+ * Queue one move, first consuming the oldest block if the buffer is full,
+ * just as the Stepper ISR would when streaming. Return false on failure.
+ */
+bool PlannerBench::feed(const xyze_pos_t &target, const_feedRate_t fr_mm_s) {
+  while (planner.is_full()) {
+    if (!planner.get_current_block()) return false;
+    planner.release_current_block();
+    blocks_drained++;
+  }
+
+  planner.buffer_line(target, fr_mm_s);
+
+  // Keep heaters and the watchdog serviced outside of the sampled sections
+  if (!(++moves_fed & 0x1F)) idle();
+
+  return true;
+}
+
+void PlannerBench::run(const Pattern pattern, const uint32_t moves, const_float_t seg_mm, const_float_t radius, const_feedRate_t fr_mm_s
+  OPTARG(SDSUPPORT, const char * const filename/*=nullptr*/)
+) {
+  #if ENABLED(SDSUPPORT)
+    if (filename) {
+      card.openFileRead(filename);
+      if (!card.isFileOpen()) { SERIAL_ECHOLNPAIR("Failed to open ", filename); return; }
+    }
+  #endif
+
+  planner.synchronize();
+
+  const bool was_enabled = stepper.suspend();
+  reset();
+  active = true;
+
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    const bool old_cold_extrude = thermalManager.allow_cold_extrude;
+    thermalManager.allow_cold_extrude = true;
+  #endif
+
+  constexpr float e_per_mm = 0.033f;  // Typical 0.4mm nozzle, 0.2mm layer, 1.75mm filament
+  xyze_pos_t pos = current_position;
+  const xyze_pos_t start = pos;
+  bool ok = true;
+
+  #if ENABLED(SDSUPPORT)
+    if (filename) {
+      // Minimal G-code interpreter: G0/G1, G90/G91, G92, M82/M83
+      char line[MAX_CMD_SIZE];
+      bool rel = false, e_rel = false;
+      feedRate_t fr = fr_mm_s;
+      while (ok && !card.eof()) {
+        uint8_t len = 0;
+        for (int16_t c; (c = card.get()) >= 0 && c != '\n';)
+          if (c != '\r' && len < sizeof(line) - 1) line[len++] = c;
+        line[len] = '\0';
+        if (char * const semi = strchr(line, ';')) *semi = '\0';
+
+        parser.parse(line);
+        if (parser.command_letter == 'G') switch (parser.codenum) {
+          case 0: case 1:
+            LOOP_LINEAR_AXES(i) if (parser.seenval(axis_codes[i])) {
+              const float v = parser.value_axis_units((AxisEnum)i);
+              pos[i] = rel ? pos[i] + v : v;
+            }
+            #if HAS_EXTRUDERS
+              if (parser.seenval('E')) {
+                const float v = parser.value_axis_units(E_AXIS);
+                pos.e = (rel || e_rel) ? pos.e + v : v;
+              }
+            #endif
+            if (parser.seenval('F')) fr = MMM_TO_MMS(parser.value_feedrate());
+            ok = feed(pos, fr);
+            break;
+          case 90: rel = false; break;
+          case 91: rel = true; break;
+          case 92: LOOP_LOGICAL_AXES(i) if (parser.seenval(axis_codes[i])) pos[i] = parser.value_axis_units((AxisEnum)i); break;
+        }
+        else if (parser.command_letter == 'M') switch (parser.codenum) {
+          case 82: e_rel = false; break;
+          case 83: e_rel = true; break;
+        }
+      }
+      card.closefile();
+    }
+    else
+  #endif
+  {
+    float angle = 0;
+    for (uint32_t n = 0; n < moves; n++) {
+      switch (pattern) {
+        default:
+        case PATTERN_CURVE:   // Slowly turning polyline, like a tessellated freeform perimeter
+          angle = 0.3f * sinf(n * seg_mm / radius);
+          pos.x += seg_mm * cosf(angle);
+          pos.y += seg_mm * sinf(angle);
+          break;
+        case PATTERN_ARC:     // Circle of the given radius chopped into seg_mm chords
+          angle += seg_mm / radius;
+          pos.x = start.x + radius * (cosf(angle) - 1.0f);
+          pos.y = start.y + radius * sinf(angle);
+          break;
+        case PATTERN_ZIGZAG:  // Short infill lines with 180° reversals
+          pos.x += (n & 1) ? -seg_mm : seg_mm;
+          pos.y += seg_mm * 0.1f;
+          break;
+      }
+      TERN_(HAS_EXTRUDERS, pos.e += seg_mm * e_per_mm);
+      if (!(ok = feed(pos, fr_mm_s))) break;
+    }
+  }
+
+  active = false;
+
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = old_cold_extrude);
+
+  // Nothing was stepped, so drop the plan and return to the real position
+  planner.clear_block_buffer();
+  planner.set_position_mm(current_position);
+  if (was_enabled) stepper.wake_up();
+
+  if (!ok) SERIAL_ECHOLNPGM("Planner benchmark aborted: no block available to drain.");
+  report();
+}
+
+/**
+ * Parse and run G1 lines of a short zigzag with extrusion, draining the planner
+ * as in run(). With PRECOMPILED_GCODE the next lines also go through precompile(),
+ * as when queued, and restore(), as when dispatched.
+ */
+void PlannerBench::check_dispatch(const uint32_t count) {
+  planner.synchronize();
+
+  const bool was_enabled = stepper.suspend();
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    const bool old_cold_extrude = thermalManager.allow_cold_extrude;
+    thermalManager.allow_cold_extrude = true;
+  #endif
+  const xyze_pos_t old_position = current_position;
+  const feedRate_t old_feedrate = feedrate_mm_s;
+
+  char line[MAX_CMD_SIZE];
+  auto make_line = [&](const uint32_t n) {
+    const uint16_t x = 10000 + (n % 100) * 150, y = 10000 + (n / 100 % 100) * 150, e = n % 10000;
+    sprintf_P(line, PSTR("G1 X%u.%03u Y%u.%03u E%u.%04u F3000"), x / 1000, x % 1000, y / 1000, y % 1000, uint16_t(n / 10000), e);
+  };
+  auto make_room = [&]{
+    while (planner.is_full() && planner.get_current_block()) {
+      planner.release_current_block();
+      blocks_drained++;
+    }
+  };
+
+  uint64_t parse_cycles = 0, run_cycles = 0;
+  for (uint32_t n = 0; n < count; n++) {
+    make_line(n);
+    make_room();
+    const uint32_t start = cycle_count();
+    parser.parse(line);
+    const uint32_t parsed = cycle_count();
+    gcode.process_parsed_command(true);
+    run_cycles += cycle_count() - parsed;
+    parse_cycles += parsed - start;
+    if (!(n & 0x1F)) idle();
+  }
+
+  #if ENABLED(PRECOMPILED_GCODE)
+    precompiled_gcode_t pc;
+    uint64_t precompile_cycles = 0, restore_cycles = 0, run_pre_cycles = 0;
+    for (uint32_t n = count; n < 2 * count; n++) {
+      make_line(n);
+      make_room();
+      const uint32_t start = cycle_count();
+      parser.precompile(line, pc);
+      const uint32_t queued = cycle_count();
+      parser.restore(line, pc);
+      const uint32_t restored = cycle_count();
+      gcode.process_parsed_command(true);
+      run_pre_cycles += cycle_count() - restored;
+      restore_cycles += restored - queued;
+      precompile_cycles += queued - start;
+      if (!(n & 0x1F)) idle();
+    }
+  #endif
+
+  parser.reset();   // Drop the local line and precompiled state
+
+  // Nothing was stepped, so drop the plan and return to the real position
+  planner.clear_block_buffer();
+  current_position = old_position;
+  feedrate_mm_s = old_feedrate;
+  planner.set_position_mm(current_position);
+  if (was_enabled) stepper.wake_up();
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = old_cold_extrude);
+
+  if (!count) return;
+  auto per_s = [&](const uint64_t cycles) { return uint32_t(cycles ? count * uint64_t(F_CPU) / cycles : 0); };
+  SERIAL_ECHOLNPAIR("Dispatch benchmark, ", count, " G1 lines (cycles/command):");
+  SERIAL_ECHOLNPAIR("  text parse:", uint32_t(parse_cycles / count), " run:", uint32_t(run_cycles / count),
+                    " commands/s:", per_s(parse_cycles + run_cycles));
+  #if ENABLED(PRECOMPILED_GCODE)
+    SERIAL_ECHOLNPAIR("  precompiled queue:", uint32_t(precompile_cycles / count), " restore:", uint32_t(restore_cycles / count),
+                      " run:", uint32_t(run_pre_cycles / count), " commands/s:", per_s(restore_cycles + run_pre_cycles));
+  #endif
+}
+
+#if ENABLED(FIXED_POINT_TRAPEZOID)
+
+  /**
+   * The float path rounds the squared rates to 24 bits, so it can't be matched bit-for-bit.
+   * Instead the integer results must equal the same formulas evaluated in double precision,
+   * which is exact for these ranges, and the deviation of the float path is reported.
+   */
+  void PlannerBench::check_trapezoids(const uint32_t count) {
+    enum : uint8_t { ACCEL, DECEL, INTERSECT, CRUISE, ACCEL_TIME, FIELD_COUNT };
+    uint32_t mismatches[FIELD_COUNT] = { 0 }, float_diff[FIELD_COUNT] = { 0 };
+
+    uint32_t seed = 0x2545F491;
+    auto rnd = [&](const uint32_t lo, const uint32_t hi) {
+      seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;  // xorshift32
+      return lo + seed % (hi - lo + 1);
+    };
+    auto compare = [&](const uint8_t field, const int32_t i, const int32_t exact, const int32_t f) {
+      if (i != exact) mismatches[field]++;
+      NOLESS(float_diff[field], uint32_t(ABS(f - i)));
+    };
+
+    for (uint32_t n = 0; n < count; n++) {
+      // A spread of rates, accelerations and lengths typical of XY, Z and E blocks
+      const uint32_t nominal_rate = rnd(120, 250000),   // From MINIMAL_STEP_RATE
+                     initial_rate = rnd(120, nominal_rate),
+                     final_rate = rnd(120, nominal_rate),
+                     steps = rnd(1, 200000);
+      const int32_t accel = rnd(1000, 1500000);
+      const double ni = nominal_rate, ii = initial_rate, fi = final_rate, a = accel;
+
+      compare(ACCEL, Planner::estimate_acceleration_steps(initial_rate, nominal_rate, accel, true),
+                     ceil((ni * ni - ii * ii) / (a * 2)),
+                     CEIL(Planner::estimate_acceleration_distance(initial_rate, nominal_rate, accel)));
+      compare(DECEL, Planner::estimate_acceleration_steps(final_rate, nominal_rate, accel, false),
+                     floor((ni * ni - fi * fi) / (a * 2)),
+                     FLOOR(Planner::estimate_acceleration_distance(nominal_rate, final_rate, -accel)));
+
+      const int32_t inter = Planner::intersection_steps(initial_rate, final_rate, accel, steps);
+      compare(INTERSECT, inter,
+                         ceil((a * 2 * steps - ii * ii + fi * fi) / (a * 4)),
+                         CEIL(Planner::intersection_distance(initial_rate, final_rate, accel, steps)));
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+        const uint32_t accel_steps = constrain(inter, 0, int32_t(steps)),
+                       cruise_rate = Planner::final_rate_after(initial_rate, accel, accel_steps);
+        compare(CRUISE, cruise_rate,
+                        floor(sqrt(ii * ii + a * 2 * accel_steps)),
+                        Planner::final_speed(initial_rate, accel, accel_steps));
+        compare(ACCEL_TIME, Planner::rate_change_ticks(cruise_rate - initial_rate, accel),
+                            floor(double(cruise_rate - initial_rate) * (STEPPER_TIMER_RATE) / a),
+                            ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE));
+      #endif
+
+      if (!(n & 0x3FF)) idle();
+    }
+
+    static PGMSTR(acc_str, "accelerate_steps");
+    static PGMSTR(dec_str, "decelerate_steps");
+    static PGMSTR(int_str, "intersection");
+    static PGMSTR(cru_str, "cruise_rate");
+    static PGMSTR(tim_str, "acceleration_time");
+    static PGM_P const labels[FIELD_COUNT] PROGMEM = { acc_str, dec_str, int_str, cru_str, tim_str };
+
+    SERIAL_ECHOLNPAIR("Fixed-point trapezoids, ", count, " random blocks:");
+    LOOP_L_N(i, TERN(S_CURVE_ACCELERATION, FIELD_COUNT, CRUISE)) {
+      SERIAL_ECHOPGM("  ");
+      serialprintPGM((PGM_P)pgm_read_ptr(&labels[i]));
+      SERIAL_ECHOLNPAIR(" mismatches:", mismatches[i], " max float deviation:", float_diff[i]);
+    }
+  }
+
+#endif // FIXED_POINT_TRAPEZOID
+
+#if ENABLED(INCREMENTAL_IK)
+
+  void PlannerBench::check_kinematics(const uint32_t count, const_float_t seg_mm) {
+    uint32_t seed = 0x2545F491;
+    auto rnd = [&](const_float_t lo, const_float_t hi) {
+      seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;  // xorshift32
+      return lo + (hi - lo) * float(seed & 0xFFFF) * (1.0f / 0xFFFF);
+    };
+
+    uint64_t exact_cycles = 0, incr_cycles = 0;
+    uint32_t segments_done = 0;
+    float max_err = 0, max_err_steps = 0;
+
+    for (uint32_t n = 0; n < count;) {
+      // A random line with every sampled point reachable
+      xyze_pos_t a, b;
+      a.reset(); b.reset();
+      a.set(rnd(X_MIN_POS, X_MAX_POS), rnd(Y_MIN_POS, Y_MAX_POS), rnd(Z_MIN_POS, Z_MIN_POS + 0.25f * ((Z_MAX_POS) - (Z_MIN_POS))));
+      b.set(rnd(X_MIN_POS, X_MAX_POS), rnd(Y_MIN_POS, Y_MAX_POS), rnd(Z_MIN_POS, Z_MIN_POS + 0.25f * ((Z_MAX_POS) - (Z_MIN_POS))));
+      const xyze_float_t diff = b - a;
+      bool reachable = true;
+      for (uint8_t i = 0; i <= 8 && reachable; i++) {
+        const xyze_pos_t p = a + diff * (i * 0.125f);
+        reachable = position_is_reachable(p.x, p.y);
+        if (reachable) {
+          inverse_kinematics(p);                              // Within reach of the arms, too
+          LOOP_ABC(j) if (isnan(delta[j])) reachable = false;
+        }
+      }
+      if (!reachable) continue;
+      n++;
+
+      const uint16_t segments = _MAX(uint16_t(diff.magnitude() / seg_mm), uint16_t(1));
+      const xyze_float_t step = diff / float(segments);
+      abce_pos_t joints;
+
+      // Time the exact IK, as done by Planner::buffer_line for each segment
+      uint32_t start = cycle_count();
+      for (uint16_t i = 1; i < segments; i++) {
+        xyze_pos_t machine = a + step * float(i);
+        TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(machine));
+        inverse_kinematics(machine);
+        joints = delta;
+      }
+      exact_cycles += cycle_count() - start;
+
+      // Time the interpolation, with its knots
+      start = cycle_count();
+      if (incremental_ik.begin(a, step, segments))
+        for (uint16_t i = 1; i < segments; i++) incremental_ik.next(joints);
+      incr_cycles += cycle_count() - start;
+
+      // Compare each segment (untimed)
+      if (incremental_ik.begin(a, step, segments)) {
+        for (uint16_t i = 1; i < segments; i++) {
+          incremental_ik.next(joints);
+          xyz_pos_t exact;
+          incremental_ik.solve(i, exact);
+          LOOP_ABC(j) {
+            const float err = ABS(joints[j] - exact[j]);
+            NOLESS(max_err, err);
+            NOLESS(max_err_steps, err * planner.settings.axis_steps_per_mm[j]);
+          }
+        }
+      }
+      segments_done += segments - 1;
+
+      if (!(n & 0x3F)) idle();
+    }
+
+    SERIAL_ECHOLNPAIR("Incremental IK, ", count, " random lines, ", segments_done, " segments, knots every ", INCREMENTAL_IK_SPAN, ":");
+    if (segments_done) SERIAL_ECHOLNPAIR("  cycles/segment exact:", uint32_t(exact_cycles / segments_done), " incremental:", uint32_t(incr_cycles / segments_done));
+    SERIAL_ECHOLNPAIR_F("  max error:", max_err, 5);
+    SERIAL_ECHOLNPAIR_F("  max error (steps):", max_err_steps, 3);
+  }
+
+#endif // INCREMENTAL_IK
+
+#if ENABLED(UBL_CELL_CACHE)
+
+  void PlannerBench::check_cell_cache(const uint32_t count, const_float_t seg_mm) {
+    if (!ubl.mesh_is_valid()) { SERIAL_ECHOLNPGM("?Mesh incomplete."); return; }
+
+    uint32_t seed = 0x2545F491;
+    auto rnd = [&](const_float_t lo, const_float_t hi) {
+      seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;  // xorshift32
+      return lo + (hi - lo) * float(seed & 0xFFFF) * (1.0f / 0xFFFF);
+    };
+
+    uint64_t lookup_cycles = 0, walk_cycles = 0;
+    uint32_t segments_done = 0;
+    float max_err = 0, zsum = 0;
+
+    for (uint32_t n = 0; n < count; n++) {
+      const xy_pos_t a = { rnd(MESH_MIN_X, MESH_MAX_X), rnd(MESH_MIN_Y, MESH_MAX_Y) },
+                     b = { rnd(MESH_MIN_X, MESH_MAX_X), rnd(MESH_MIN_Y, MESH_MAX_Y) };
+      const xy_float_t diff = b - a;
+      const uint16_t segments = _MAX(uint16_t(diff.magnitude() / seg_mm), uint16_t(1));
+      const xy_float_t step = diff / float(segments);
+
+      // Time a lookup per segment, as the segmented moves did without the cache
+      uint32_t start = cycle_count();
+      xy_pos_t p = a;
+      for (uint16_t i = 0; i < segments; i++, p += step) zsum += ubl.get_z_correction(p);
+      lookup_cycles += cycle_count() - start;
+
+      // Time the cell walk
+      start = cycle_count();
+      unified_bed_leveling::cell_walker_t walker;
+      walker.start(a);
+      for (uint16_t i = 0; i < segments; i++, walker.advance(step)) zsum += walker.z();
+      walk_cycles += cycle_count() - start;
+
+      // Compare each segment (untimed)
+      p = a;
+      walker.start(a);
+      for (uint16_t i = 0; i < segments; i++, p += step, walker.advance(step))
+        NOLESS(max_err, ABS(walker.z() - ubl.get_z_correction(p)));
+
+      segments_done += segments;
+
+      if (!(n & 0x3F)) idle();
+    }
+
+    SERIAL_ECHOLNPAIR("UBL cell cache, ", count, " random lines, ", segments_done, " segments:");
+    if (lookup_cycles && walk_cycles) SERIAL_ECHOLNPAIR("  segments/s lookup:", uint32_t(segments_done * uint64_t(F_CPU) / lookup_cycles), " walk:", uint32_t(segments_done * uint64_t(F_CPU) / walk_cycles));
+    SERIAL_ECHOLNPAIR_F("  max difference:", max_err, 6);
+    if (isnan(zsum)) SERIAL_ECHOLNPGM("  NaN");                 // Keep the timed loops from being optimized away
+  }
+
+#endif // UBL_CELL_CACHE
+
+void PlannerBench::report() {
+  const cycle_stats_t &bl = stats[BUFFER_LINE];
+  const uint32_t us = uint32_t(bl.total / ((F_CPU) / 1000000UL));
+  SERIAL_ECHOLNPAIR("Planner benchmark: ", moves_fed, " moves, ", blocks_drained, " blocks drained, ", us, "us in buffer_line");
+  if (us) SERIAL_ECHOLNPAIR("  ", uint32_t(uint64_t(moves_fed) * 1000000UL / us), " moves/s, worst recalculate ", cycles_to_us(stats[RECALCULATE].max), "us");
+
+  static PGMSTR(bl_str, "buffer_line");
+  static PGMSTR(rc_str, "recalculate");
+  static PGMSTR(rp_str, " reverse_pass");
+  static PGMSTR(fp_str, " forward_pass");
+  static PGMSTR(rt_str, " recalculate_trapezoids");
+  static PGM_P const labels[SECTION_COUNT] PROGMEM = { bl_str, rc_str, rp_str, fp_str, rt_str };
+  LOOP_L_N(i, SECTION_COUNT) stats[i].report((PGM_P)pgm_read_ptr(&labels[i]));
+
+  // Kernel invocations per move, against a walk of the whole plan
+  if (moves_fed) LOOP_L_N(i, 3) {
+    const float done = float(counters[i * 2]) / moves_fed,
+                full = float(counters[i * 2 + 1]) / moves_fed;
+    serialprintPGM((PGM_P)pgm_read_ptr(&labels[i + REVERSE_PASS]));
+    SERIAL_ECHOLNPAIR(" kernels/move:", done, " full:", full, " saved:", full - done);
+  }
+}
+
+#endif // PLANNER_BENCHMARK
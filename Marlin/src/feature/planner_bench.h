@@ -0,0 +1,105 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_bench.h - Headless planner throughput benchmark (D110)
+ *
+ * Streams a synthetic path or a G-code file from SD through Planner::buffer_line
+ * with the Stepper ISR held off. The oldest block is discarded whenever the buffer
+ * fills, so the planner runs in its steady streaming state. Cycles spent in
+ * buffer_line, recalculate and the planner passes are sampled into histograms.
+ */
+
+#include "../libs/cycle_counter.h"
+
+class PlannerBench {
+public:
+  enum Section : uint8_t {
+    BUFFER_LINE, RECALCULATE, REVERSE_PASS, FORWARD_PASS, RECALCULATE_TRAPEZOIDS,
+    SECTION_COUNT
+  };
+
+  // Blocks visited by each planner pass, and the number a walk of the whole plan would visit
+  enum Counter : uint8_t {
+    REVERSE_KERNELS, REVERSE_FULL, FORWARD_KERNELS, FORWARD_FULL, TRAPEZOIDS, TRAPEZOIDS_FULL,
+    COUNTER_COUNT
+  };
+
+  enum Pattern : uint8_t { PATTERN_CURVE, PATTERN_ARC, PATTERN_ZIGZAG };
+
+  static bool active;                         // Sampling enabled and Stepper ISR held off
+  static cycle_stats_t stats[SECTION_COUNT];
+  static uint32_t counters[COUNTER_COUNT];
+
+  static inline void count(const Counter c, const uint8_t n) { if (active) counters[c] += n; }
+
+  static void reset();
+  static void report();
+
+  /**
+   * Run a benchmark and report the results
+   *
+   *  pattern  - PATTERN_CURVE (small-segment wave), PATTERN_ARC (dense circle), PATTERN_ZIGZAG (sharp reversals)
+   *  moves    - Number of segments to plan
+   *  seg_mm   - Segment length (mm)
+   *  radius   - Arc radius / wave amplitude (mm)
+   *  fr_mm_s  - Feedrate (mm/s)
+   *  filename - G-code file on SD to stream instead of a pattern (optional)
+   */
+  static void run(const Pattern pattern, const uint32_t moves, const_float_t seg_mm, const_float_t radius, const_feedRate_t fr_mm_s
+    OPTARG(SDSUPPORT, const char * const filename=nullptr)
+  );
+
+  // Time G1 commands from text to the planner, as the queue dispatches them
+  static void check_dispatch(const uint32_t count);
+
+  #if ENABLED(FIXED_POINT_TRAPEZOID)
+    // Compare the integer trapezoid math with the float path for random blocks
+    static void check_trapezoids(const uint32_t count);
+  #endif
+
+  #if ENABLED(INCREMENTAL_IK)
+    // Compare interpolated joint positions with exact IK for random segmented lines
+    static void check_kinematics(const uint32_t count, const_float_t seg_mm);
+  #endif
+
+  #if ENABLED(UBL_CELL_CACHE)
+    // Compare the cached mesh cell walk with get_z_correction for random segmented lines
+    static void check_cell_cache(const uint32_t count, const_float_t seg_mm);
+  #endif
+
+  // Scoped sample of one planner section
+  class Probe {
+    const Section section;
+    const uint32_t start;
+  public:
+    FORCE_INLINE Probe(const Section s) : section(s), start(active ? cycle_count() : 0) {}
+    FORCE_INLINE ~Probe() { if (active) stats[section].record(cycle_count() - start); }
+  };
+
+private:
+  static uint32_t moves_fed, blocks_drained;
+  static bool feed(const xyze_pos_t &target, const_feedRate_t fr_mm_s);
+};
+
+extern PlannerBench planner_bench;
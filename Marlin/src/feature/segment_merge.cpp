@@ -0,0 +1,121 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+/**
+ * segment_merge.cpp - Merge runs of nearly collinear moves (G64 Q)
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SEGMENT_MERGING)
+
+#include "segment_merge.h"
+
+#if ENABLED(CORNER_BLENDING)
+  #include "corner_blend.h"
+#endif
+
+SegmentMerge segment_merge;
+
+float SegmentMerge::tolerance = SEGMENT_MERGING_TOLERANCE;
+bool SegmentMerge::valid, SegmentMerge::held, SegmentMerge::busy; // = false
+xyze_pos_t SegmentMerge::start, SegmentMerge::end;
+feedRate_t SegmentMerge::held_fr_mm_s;
+uint8_t SegmentMerge::held_extruder, SegmentMerge::merged;
+xyze_pos_t SegmentMerge::vertex[SEGMENT_MERGING_MAX_SEGMENTS - 1];
+
+// Pass a move on to corner blending or the planner, forgetting the path if it's dropped
+bool SegmentMerge::emit(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder) {
+  busy = true;
+  const bool ok = TERN(CORNER_BLENDING, corner_blend.add, planner._buffer_line)(target, fr_mm_s, extruder);
+  busy = false;
+  if (!ok) held = valid = false;
+  return ok;
+}
+
+void SegmentMerge::flush() {
+  if (!held || busy) return;
+  held = false;
+  emit(end, held_fr_mm_s, held_extruder);
+}
+
+// Can the held move be stretched to 'target' without leaving the tolerance?
+bool SegmentMerge::can_merge(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder) {
+  if (merged >= SEGMENT_MERGING_MAX_SEGMENTS - 1 || extruder != held_extruder || fr_mm_s != held_fr_mm_s)
+    return false;
+
+  const xyz_pos_t chord = xyz_pos_t(target) - xyz_pos_t(start),
+                  seg = xyz_pos_t(target) - xyz_pos_t(end);
+  const float L = chord.magnitude(), Ls = seg.magnitude();
+  if (L < 0.001f || Ls < 0.001f) return false;
+
+  // The new segment must keep the direction of the merged move...
+  const xyz_pos_t u = chord / L;
+  const float min_cos = cos(RADIANS(SEGMENT_MERGING_MAX_ANGLE));
+  if (u.x * seg.x + u.y * seg.y + u.z * seg.z < min_cos * Ls) return false;
+
+  // ...and extrude, retract or travel like the rest of it
+  const float de = target.e - end.e, DE = end.e - start.e;
+  if ((de > 0) != (DE > 0) || (de < 0) != (DE < 0)) return false;
+
+  // Every vertex, with its E, must lie close to the merged move
+  const float E = target.e - start.e, max_de = SEGMENT_MERGING_E_TOLERANCE * ABS(E) + 0.00001f;
+  for (uint8_t v = 0; v <= merged; ++v) {
+    const xyze_pos_t &p = v < merged ? vertex[v] : end;
+    const xyz_pos_t w = xyz_pos_t(p) - xyz_pos_t(start);
+    const float s = u.x * w.x + u.y * w.y + u.z * w.z;
+    if (!WITHIN(s, 0, L) || (w - u * s).magnitude() > tolerance) return false;
+    if (ABS(p.e - (start.e + E * s / L)) > max_de) return false;
+  }
+  return true;
+}
+
+bool SegmentMerge::add(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder) {
+
+  // No merging or an unknown start: Pass the move on as-is
+  if (!tolerance || !valid) {
+    flush();
+    valid = emit(target, fr_mm_s, extruder);
+    end = target;
+    return valid;
+  }
+
+  if (held && can_merge(target, fr_mm_s, extruder)) {
+    vertex[merged++] = end;
+    end = target;
+    return true;
+  }
+
+  // Pass on the merged move and start a new one
+  flush();
+  if (!valid) return false;
+  start = end;
+  end = target;
+  held_fr_mm_s = fr_mm_s;
+  held_extruder = extruder;
+  merged = 0;
+  held = true;
+  return true;
+}
+
+#endif // SEGMENT_MERGING
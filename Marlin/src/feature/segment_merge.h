@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * segment_merge.h - Merge runs of nearly collinear moves (G64 Q<tolerance>)
+ *
+ * Each move is held back while the following moves continue along the same
+ * line. Their vertices must all stay within the tolerance of the merged move,
+ * with the same feedrate, tool and extrusion rate. The planner then gets one
+ * block where the slicer emitted many.
+ */
+
+#include "../module/planner.h"
+
+class SegmentMerge {
+public:
+  static float tolerance;                     // Maximum distance of a merged vertex from the move, in mm (0 = no merging)
+
+  // Add a move ahead of the planner. Return false if it was dropped.
+  static bool add(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder);
+
+  // Pass on the merged move, if any
+  static void flush();
+
+  // Flush before the planner position is changed or moves bypass the merging
+  static inline void reset() { if (!busy) { flush(); valid = false; } }
+
+  // Flush before the E position is changed (i.e., G92 E0), keeping the path
+  static inline void set_e(const_float_t e) { if (!busy) { flush(); end.e = e; } }
+
+  // Forget the merged move after a quick stop
+  static inline void discard() { held = valid = false; }
+
+  // Don't let the planner run dry while merging. Called from the main loop.
+  static inline void task() { if (held && !busy && planner.movesplanned() < 2) flush(); }
+
+private:
+  static bool valid,                          // The end of the last move is known
+              held,                           // A merged move is waiting for more segments
+              busy;                           // Passing on a move
+  static xyze_pos_t start, end;               // The merged move, or 'end' of the last move
+  static feedRate_t held_fr_mm_s;
+  static uint8_t held_extruder, merged;
+  static xyze_pos_t vertex[SEGMENT_MERGING_MAX_SEGMENTS - 1]; // Vertices inside the merged move
+
+  static bool emit(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder);
+  static bool can_merge(const xyze_pos_t &target, const_feedRate_t fr_mm_s, const uint8_t extruder);
+};
+
+extern SegmentMerge segment_merge;
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * stepper_profile.cpp - Stepper ISR load profiler (M197)
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+
+#include "stepper_profile.h"
+#include "../module/stepper.h"
+
+StepperProfile stepper_profile;
+
+bool StepperProfile::active = true;
+cycle_stats_t StepperProfile::stats[PHASE_COUNT];
+millis_t StepperProfile::start_ms; // = 0
+
+void StepperProfile::reset() {
+  const bool was_enabled = stepper.suspend();
+  LOOP_L_N(i, PHASE_COUNT) stats[i].reset();
+  start_ms = millis();
+  if (was_enabled) stepper.wake_up();
+}
+
+void StepperProfile::report() {
+  // Take a consistent copy, since the ISR keeps sampling
+  cycle_stats_t copy[PHASE_COUNT];
+  const bool was_enabled = stepper.suspend();
+  COPY(copy, stats);
+  const millis_t ms = millis() - start_ms;
+  if (was_enabled) stepper.wake_up();
+
+  // Share of the CPU taken by the Stepper ISR
+  const uint64_t period = uint64_t(ms) * ((F_CPU) / 1000UL);
+  const float load = period ? 100.0f * copy[STEPPER_ISR].total / period : 0;
+  SERIAL_ECHOLNPAIR("Stepper ISR load: ", load, "% over ", ms, "ms", active ? "" : " (paused)");
+
+  static PGMSTR(isr_str, "Stepper ISR");
+  static PGMSTR(pp_str, " pulse_phase");
+  static PGMSTR(bp_str, " block_phase");
+  static PGMSTR(la_str, " advance");
+  static PGMSTR(bs_str, " babystepping");
+  static PGMSTR(is_str, " shaping");
+  static PGMSTR(bl_str, " backlash");
+  static PGM_P const labels[PHASE_COUNT] PROGMEM = { isr_str, pp_str, bp_str, la_str, bs_str, is_str, bl_str };
+  LOOP_L_N(i, PHASE_COUNT) {
+    if (  (i == ADVANCE_PHASE && DISABLED(LIN_ADVANCE))
+       || (i == BABYSTEP_PHASE && DISABLED(INTEGRATED_BABYSTEPPING))
+       || (i == SHAPING_PHASE && DISABLED(HAS_SHAPING))
+       || (i == BACKLASH_PHASE && DISABLED(BACKLASH_STREAM))
+    ) continue;
+    copy[i].report((PGM_P)pgm_read_ptr(&labels[i]));
+  }
+}
+
+#endif // STEPPER_ISR_PROFILE
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * stepper_profile.h - Stepper ISR load profiler (M197)
+ *
+ * Samples the CPU cycles taken by each call of the Stepper ISR and its phases,
+ * to show how much headroom each motion feature leaves while printing.
+ */
+
+#include "../libs/cycle_counter.h"
+
+class StepperProfile {
+public:
+  enum Phase : uint8_t {
+    STEPPER_ISR, PULSE_PHASE, BLOCK_PHASE, ADVANCE_PHASE, BABYSTEP_PHASE, SHAPING_PHASE, BACKLASH_PHASE,
+    PHASE_COUNT
+  };
+
+  static bool active;                         // Sampling enabled
+  static cycle_stats_t stats[PHASE_COUNT];
+  static millis_t start_ms;                   // Start of the sampling period
+
+  static void reset();
+  static void report();
+
+  // Scoped sample of one ISR phase
+  class Probe {
+    const Phase phase;
+    const uint32_t start;
+  public:
+    FORCE_INLINE Probe(const Phase p) : phase(p), start(active ? cycle_count() : 0) {}
+    FORCE_INLINE ~Probe() { if (active) stats[phase].record(cycle_count() - start); }
+  };
+};
+
+extern StepperProfile stepper_profile;
@@ -75,6 +75,8 @@ void GcodeSuite::M420() {
         Z_VALUES(x, y) = 0.001 * random(-200, 200);
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
       }
+      TERN_(AUTO_BED_LEVELING_BILINEAR, refresh_bed_level());
+      TERN_(UBL_CELL_CACHE, ubl.refresh_cells());
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPAIR(" (", x_min);
       SERIAL_CHAR(','); SERIAL_ECHO(y_min);
@@ -179,6 +181,8 @@ void GcodeSuite::M420() {
               TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
             }
             TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+            TERN_(ABL_BICUBIC, bed_level_bicubic_refresh());
+            TERN_(UBL_CELL_CACHE, ubl.refresh_cells());
           }
 
         #endif
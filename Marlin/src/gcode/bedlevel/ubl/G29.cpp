@@ -41,6 +41,8 @@ void GcodeSuite::G29() {
 
   ubl.G29();
 
+  TERN_(UBL_CELL_CACHE, ubl.refresh_cells()); // The mesh may have changed
+
   TERN_(FULL_REPORT_TO_HOST_FEATURE, set_and_report_grblstate(M_IDLE));
 }
 
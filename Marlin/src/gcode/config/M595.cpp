@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_BUFFER_TIME)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M595 - Planner buffer time
+ *
+ *   L<ms> - Slow down with less motion queued (Requires SLOWDOWN)
+ *   H<ms> - Queue no more motion than this. 0 for no limit.
+ *   R     - Reset the low-water mark and slowdown count after reporting
+ *
+ * With no L or H, report the queued motion time and moves, the least time
+ * queued ahead of a new move and the number of slowed moves.
+ */
+void GcodeSuite::M595() {
+  if (parser.seen("LH")) {
+    if (parser.seenval('L')) planner.buffer_time_min_ms = parser.value_ushort();
+    if (parser.seenval('H')) planner.buffer_time_max_ms = parser.value_ushort();
+    return;
+  }
+
+  const uint32_t low_us = planner.buffer_time_low_us;
+  SERIAL_ECHO_MSG(
+    "Buffer ", planner.buffered_time_us() / 1000UL, "ms"
+    " Moves:", planner.movesplanned(),
+    " Low:", low_us == UINT32_MAX ? 0UL : low_us / 1000UL, "ms"
+    " Slowdowns:", planner.buffer_slowdowns,
+    " L", planner.buffer_time_min_ms, " H", planner.buffer_time_max_ms
+  );
+  if (parser.seen_test('R')) planner.reset_buffer_stats();
+}
+
+#endif // PLANNER_BUFFER_TIME
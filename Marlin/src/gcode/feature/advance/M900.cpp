@@ -39,6 +39,7 @@
  *  K<factor>   Set current advance K factor (Slot 0).
  *  L<factor>   Set secondary advance K factor (Slot 1). Requires EXTRA_LIN_ADVANCE_K.
  *  S<0/1>      Activate slot 0 or 1. Requires EXTRA_LIN_ADVANCE_K.
+ *  W<seconds>  Set the advance smoothing time (0-0.2). Requires LA_PRESSURE_PROFILE.
  */
 void GcodeSuite::M900() {
 
@@ -110,6 +111,18 @@ void GcodeSuite::M900() {
     kref = newK;
   }
 
+  #if ENABLED(LA_PRESSURE_PROFILE)
+    if (parser.seenval('W')) {
+      const float W = parser.value_float();
+      if (WITHIN(W, 0, 0.2f)) {
+        planner.synchronize();
+        stepper.set_advance_smooth_time(W);
+      }
+      else
+        echo_value_oor('W', false);
+    }
+  #endif
+
   if (!parser.seen_any()) {
 
     #if ENABLED(EXTRA_LIN_ADVANCE_K)
@@ -140,6 +153,11 @@ void GcodeSuite::M900() {
       #endif
 
     #endif
+
+    #if ENABLED(LA_PRESSURE_PROFILE)
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPAIR("Advance W=", stepper.advance_smooth_time);
+    #endif
   }
 
 }
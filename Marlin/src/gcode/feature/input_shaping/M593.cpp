@@ -0,0 +1,102 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+#include "../../gcode.h"
+#include "../../../module/stepper.h"
+
+static void report_shaping(const AxisEnum axis) {
+  const shaping_params_t &params = stepper.shaping_params[axis];
+  SERIAL_ECHO_START();
+  SERIAL_CHAR(' ', AXIS_CHAR(axis));
+  if (params.frequency > 0) {
+    SERIAL_ECHOPAIR(" frequency: ", params.frequency, "Hz damping: ", params.zeta, " shaper: ");
+    SERIAL_ECHOLNPGM_P(params.type == SHAPER_ZV ? PSTR("ZV") : params.type == SHAPER_ZVD ? PSTR("ZVD") : PSTR("MZV"));
+  }
+  else
+    SERIAL_ECHOLNPGM(" shaping disabled");
+}
+
+/**
+ * M593: Get or Set Input Shaping Parameters
+ *  X           Set the X axis parameters
+ *  Y           Set the Y axis parameters
+ *  F<hz>       Resonant frequency (0 = disable, else SHAPING_MIN_FREQ or more)
+ *  D<zeta>     Damping ratio (0.0 - 0.5)
+ *  T<type>     Shaper type. 0:ZV 1:ZVD 2:MZV
+ *
+ * With no X or Y, both shaped axes are set. With no F, D or T, report.
+ */
+void GcodeSuite::M593() {
+  if (!parser.seen("FDT")) {
+    TERN_(INPUT_SHAPING_X, report_shaping(X_AXIS));
+    TERN_(INPUT_SHAPING_Y, report_shaping(Y_AXIS));
+    return;
+  }
+
+  const bool seen_X = TERN0(INPUT_SHAPING_X, parser.seen_test('X')),
+             seen_Y = TERN0(INPUT_SHAPING_Y, parser.seen_test('Y')),
+             for_X = seen_X || TERN0(INPUT_SHAPING_X, !seen_Y),
+             for_Y = seen_Y || TERN0(INPUT_SHAPING_Y, !seen_X);
+
+  shaping_params_t params[XY];
+  COPY(params, stepper.shaping_params);
+
+  if (parser.seenval('F')) {
+    const float freq = parser.value_float();
+    if (freq != 0 && freq < SHAPING_MIN_FREQ) {
+      SERIAL_ECHOLNPAIR("?Frequency (F) must be 0 or at least ", SHAPING_MIN_FREQ, "Hz.");
+      return;
+    }
+    if (for_X) params[X_AXIS].frequency = freq;
+    if (for_Y) params[Y_AXIS].frequency = freq;
+  }
+
+  if (parser.seenval('D')) {
+    const float zeta = parser.value_float();
+    if (!WITHIN(zeta, 0, 0.5f)) {
+      SERIAL_ECHOLNPGM("?Damping (D) value out of range (0-0.5).");
+      return;
+    }
+    if (for_X) params[X_AXIS].zeta = zeta;
+    if (for_Y) params[Y_AXIS].zeta = zeta;
+  }
+
+  if (parser.seenval('T')) {
+    const uint8_t type = parser.value_byte();
+    if (type > SHAPER_MZV) {
+      SERIAL_ECHOLNPGM("?Shaper type (T) must be 0 (ZV), 1 (ZVD) or 2 (MZV).");
+      return;
+    }
+    if (for_X) params[X_AXIS].type = type;
+    if (for_Y) params[Y_AXIS].type = type;
+  }
+
+  // Waits for all moves and echoes to finish
+  COPY(stepper.shaping_params, params);
+  stepper.refresh_shaping();
+}
+
+#endif // HAS_SHAPING
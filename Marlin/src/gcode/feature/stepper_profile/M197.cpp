@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+
+#include "../../gcode.h"
+#include "../../../feature/stepper_profile.h"
+
+/**
+ * M197: Stepper ISR load profile
+ *
+ *  S<0|1>  Pause or resume sampling
+ *  R       Reset the statistics after reporting
+ *
+ * With no S, report the ISR load and the cycles taken by each ISR phase.
+ */
+void GcodeSuite::M197() {
+  if (parser.seenval('S')) {
+    StepperProfile::active = parser.value_bool();
+    if (StepperProfile::active) StepperProfile::reset();
+    return;
+  }
+  StepperProfile::report();
+  if (parser.seen_test('R')) StepperProfile::reset();
+}
+
+#endif // STEPPER_ISR_PROFILE
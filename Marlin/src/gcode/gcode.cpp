@@ -405,6 +405,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 61: G61(); break;                                    // G61:  Apply/restore saved coordinates.
       #endif
 
+      #if EITHER(CORNER_BLENDING, SEGMENT_MERGING)
+        case 64: G64(); break;                                    // G64: Set path tolerances
+      #endif
+
       #if ENABLED(PROBE_TEMP_COMPENSATION)
         case 76: G76(); break;                                    // G76: Calibrate first layer compensation values
       #endif
@@ -573,6 +577,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 193: M193(); break;                                  // M193: Wait for cooler temperature to reach target
       #endif
 
+      #if ENABLED(STEPPER_ISR_PROFILE)
+        case 197: M197(); break;                                  // M197: Report Stepper ISR load
+      #endif
+
       #if ENABLED(AUTO_REPORT_POSITION)
         case 154: M154(); break;                                  // M154: Set position auto-report interval
       #endif
@@ -855,6 +863,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if HAS_SHAPING
+        case 593: M593(); break;                                  // M593: Input Shaping parameters
+      #endif
+
+      #if ENABLED(PLANNER_BUFFER_TIME)
+        case 595: M595(); break;                                  // M595: Planner buffer time
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -1069,8 +1085,13 @@ void GcodeSuite::process_next_command() {
     #endif
   }
 
-  // Parse the next command in the queue
-  parser.parse(command.buffer);
+  // Parse the next command in the queue, or restore it as parsed when queued
+  #if ENABLED(PRECOMPILED_GCODE)
+    if (command.pre.letter)
+      parser.restore(command.buffer, command.pre);
+    else
+  #endif
+      parser.parse(command.buffer);
   process_parsed_command();
 }
 
@@ -68,6 +68,7 @@
  * G35  - Read bed corners to help adjust bed screws: T<screw_thread> (Requires ASSISTED_TRAMMING)
  * G38  - Probe in any direction using the Z_MIN_PROBE (Requires G38_PROBE_TARGET)
  * G42  - Coordinated move to a mesh point (Requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BLINEAR, or AUTO_BED_LEVELING_UBL)
+ * G64  - Set the path tolerances: P<mm> corner blending, Q<mm> segment merging. (Requires CORNER_BLENDING or SEGMENT_MERGING)
  * G60  - Save current position. (Requires SAVED_POSITIONS)
  * G61  - Apply/restore saved coordinates. (Requires SAVED_POSITIONS)
  * G76  - Calibrate first layer temperature offsets. (Requires PROBE_TEMP_COMPENSATION)
@@ -168,6 +169,7 @@
  * M190 - S<temp> Wait for bed current temp to reach target temp. ** Wait only when heating! **
  *        R<temp> Wait for bed current temp to reach target temp. ** Wait for heating or cooling. **
  * M193 - R<temp> Wait for cooler temp to reach target temp. ** Wait for cooling. **
+ * M197 - Report the Stepper ISR load and the cycles taken by each phase. (Requires STEPPER_ISR_PROFILE)
  * M200 - Set filament diameter, D<diameter>, setting E axis units to cubic. (Use S0 to revert to linear units.)
  * M201 - Set max acceleration in units/s^2 for print moves: "M201 X<accel> Y<accel> Z<accel> E<accel>"
  * M202 - Set max acceleration in units/s^2 for travel moves: "M202 X<accel> Y<accel> Z<accel> E<accel>" ** UNUSED IN MARLIN! **
@@ -242,6 +244,8 @@
  * M553 - Get or set IP netmask. (Requires enabled Ethernet port)
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M593 - Get or set Input Shaping parameters: "M593 [X] [Y] F<hz> D<zeta> T<type>". (Requires INPUT_SHAPING_X or INPUT_SHAPING_Y)
+ * M595 - Set or report the planner buffer time: "M595 L<min_ms> H<max_ms> R". (Requires PLANNER_BUFFER_TIME)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -540,6 +544,10 @@ private:
     static void G59();
   #endif
 
+  #if EITHER(CORNER_BLENDING, SEGMENT_MERGING)
+    static void G64();
+  #endif
+
   #if ENABLED(PROBE_TEMP_COMPENSATION)
     static void G76();
   #endif
@@ -737,6 +745,10 @@ private:
     static void M193();
   #endif
 
+  #if ENABLED(STEPPER_ISR_PROFILE)
+    static void M197();
+  #endif
+
   #if PREHEAT_COUNT
     static void M145();
   #endif
@@ -978,6 +990,14 @@ private:
     static void M575();
   #endif
 
+  #if HAS_SHAPING
+    static void M593();
+  #endif
+
+  #if ENABLED(PLANNER_BUFFER_TIME)
+    static void M595();
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
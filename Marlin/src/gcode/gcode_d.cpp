@@ -32,6 +32,10 @@
   #include "../sd/cardreader.h"
   #include "../MarlinCore.h" // for kill
 
+  #if ENABLED(PLANNER_BENCHMARK)
+    #include "../feature/planner_bench.h"
+  #endif
+
   extern void dump_delay_accuracy_check();
 
   /**
@@ -178,6 +182,41 @@
         SERIAL_ECHOLN(gtn(&SERIAL_IMPL));
         break;
 
+      #if ENABLED(PLANNER_BENCHMARK)
+        case 110: // D110 Planner benchmark
+          planner_bench.run(
+            (PlannerBench::Pattern)parser.byteval('P'),
+            parser.ulongval('S', 1000),
+            _MAX(parser.floatval('L', 0.5f), 0.01f),
+            _MAX(parser.floatval('R', 20.0f), 1.0f),
+            parser.seenval('F') ? MMM_TO_MMS(parser.value_feedrate()) : 100.0f
+            OPTARG(SDSUPPORT, parser.string_arg)
+          );
+          break;
+
+        #if ENABLED(FIXED_POINT_TRAPEZOID)
+          case 111: // D111 Validate fixed-point trapezoids
+            planner_bench.check_trapezoids(parser.ulongval('S', 100000));
+            break;
+        #endif
+
+        #if ENABLED(INCREMENTAL_IK)
+          case 112: // D112 Compare incremental and exact inverse kinematics
+            planner_bench.check_kinematics(parser.ulongval('S', 1000), _MAX(parser.floatval('L', 1.0f), 0.01f));
+            break;
+        #endif
+
+        #if ENABLED(UBL_CELL_CACHE)
+          case 113: // D113 Compare the UBL cell cache with get_z_correction
+            planner_bench.check_cell_cache(parser.ulongval('S', 1000), _MAX(parser.floatval('L', 1.0f), 0.01f));
+            break;
+        #endif
+
+        case 114: // D114 Time G1 parsing and dispatch
+          planner_bench.check_dispatch(parser.ulongval('S', 1000));
+          break;
+      #endif
+
       case 100: { // D100 Disable heaters and attempt a hard hang (Watchdog Test)
         SERIAL_ECHOLNPGM("Disabling heaters and attempting to trigger Watchdog");
         SERIAL_ECHOLNPGM("(USE_WATCHDOG " TERN(USE_WATCHDOG, "ENABLED", "DISABLED") ")");
@@ -40,13 +40,38 @@
   #define N_ARC_CORRECTION 1
 #endif
 
+#ifdef ARC_CHORD_TOLERANCE
+
+  /**
+   * Get the longest segment that keeps the chord within ARC_CHORD_TOLERANCE of
+   * the arc, lengthened if needed so each segment takes long enough to keep the
+   * planner buffer ahead of the Stepper at the given feedrate.
+   */
+  static float arc_chord_length(const float radius, const feedRate_t fr_mm_s) {
+    constexpr float tol = ARC_CHORD_TOLERANCE;
+    const float chord = radius > tol ? 2.0f * SQRT(tol * (2.0f * radius - tol)) : 2.0f * radius;
+
+    // Shortest segment time the planner can sustain
+    uint32_t min_seg_us = planner.settings.min_segment_time_us;
+    #if ENABLED(PLANNER_BUFFER_TIME)
+      NOLESS(min_seg_us, planner.buffer_time_min_ms * 1000UL / (BLOCK_BUFFER_SIZE));
+    #endif
+
+    return _MAX(chord, fr_mm_s * min_seg_us * 0.000001f);
+  }
+
+#endif
+
 /**
  * Plan an arc in 2 dimensions, with optional linear motion in a 3rd dimension
  *
  * The arc is traced by generating many small linear segments, as configured by
- * MM_PER_ARC_SEGMENT (Default 1mm). In the future we hope more slicers will include
+ * MM_PER_ARC_SEGMENT (Default 1mm), or by ARC_CHORD_TOLERANCE. In the future we hope more slicers will include
  * an option to generate G2/G3 arcs for curved surfaces, as this will allow faster
  * boards to produce much smoother curved surfaces.
+ *
+ * With ARC_BLOCKS an XY arc is queued as a single block instead, and the
+ * Stepper traces it exactly.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -147,12 +172,43 @@ void plan_arc(
 
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
+  #if ENABLED(ARC_BLOCKS)
+    // Queue the whole arc as a single block if the Stepper can trace it as-is
+    if (TERN1(CNC_WORKSPACE_PLANES, p_axis == X_AXIS)
+      && TERN1(HAS_LEVELING, !planner.leveling_active)
+      && planner.arc_block_fits(radius)
+    ) {
+      // Arcs that might be clipped by the software endstops get segmented
+      xyze_pos_t arc_min = cart, arc_max = cart;
+      arc_min.x = center_P - radius; arc_min.y = center_Q - radius;
+      arc_max.x = center_P + radius; arc_max.y = center_Q + radius;
+      #if HAS_Z_AXIS
+        NOMORE(arc_min.z, start_L);
+        NOLESS(arc_max.z, start_L);
+      #endif
+      xyz_pos_t lim_min, lim_max;
+      lim_min = arc_min;
+      lim_max = arc_max;
+      apply_motion_limits(lim_min);
+      apply_motion_limits(lim_max);
+
+      if (lim_min == arc_min && lim_max == arc_max) {
+        const xy_pos_t center = { center_P, center_Q };
+        planner.buffer_arc(cart, center, angular_travel, scaled_fr_mm_s, active_extruder, mm_of_travel);
+        current_position = cart;
+        return;
+      }
+    }
+  #endif
+
   // Start with a nominal segment length
   float seg_length = (
     #ifdef ARC_SEGMENTS_PER_R
       constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
     #elif ARC_SEGMENTS_PER_SEC
       _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
+    #elif defined(ARC_CHORD_TOLERANCE)
+      arc_chord_length(radius, scaled_fr_mm_s)
     #else
       MM_PER_ARC_SEGMENT
     #endif
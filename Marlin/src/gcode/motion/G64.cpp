@@ -0,0 +1,83 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if EITHER(CORNER_BLENDING, SEGMENT_MERGING)
+
+#include "../gcode.h"
+
+#if ENABLED(CORNER_BLENDING)
+  #include "../../feature/corner_blend.h"
+#endif
+#if ENABLED(SEGMENT_MERGING)
+  #include "../../feature/segment_merge.h"
+#endif
+
+/**
+ * G64: Set the path tolerances
+ *
+ *  P<mm>   Maximum distance the path may cut inside a corner (0 = exact corners)
+ *  Q<mm>   Maximum distance of merged collinear vertices from the path (0 = no merging)
+ *
+ * With no P or Q, report the current tolerances.
+ */
+void GcodeSuite::G64() {
+  if (!parser.seen("PQ")) {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM("G64");
+    #if ENABLED(CORNER_BLENDING)
+      SERIAL_ECHOPGM(" P");
+      SERIAL_ECHO_F(corner_blend.tolerance, 3);
+    #endif
+    #if ENABLED(SEGMENT_MERGING)
+      SERIAL_ECHOPGM(" Q");
+      SERIAL_ECHO_F(segment_merge.tolerance, 3);
+    #endif
+    SERIAL_EOL();
+    return;
+  }
+
+  #if ENABLED(CORNER_BLENDING)
+    if (parser.seenval('P')) {
+      const float tol = parser.value_linear_units();
+      if (tol < 0) {
+        SERIAL_ECHOLNPGM("?Tolerance (P) must be 0 or greater.");
+        return;
+      }
+      corner_blend.tolerance = tol;
+    }
+  #endif
+
+  #if ENABLED(SEGMENT_MERGING)
+    if (parser.seenval('Q')) {
+      const float tol = parser.value_linear_units();
+      if (tol < 0) {
+        SERIAL_ECHOLNPGM("?Tolerance (Q) must be 0 or greater.");
+        return;
+      }
+      segment_merge.tolerance = tol;
+    }
+  #endif
+}
+
+#endif // CORNER_BLENDING || SEGMENT_MERGING
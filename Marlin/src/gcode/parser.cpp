@@ -66,6 +66,11 @@ uint16_t GCodeParser::codenum;
   char *GCodeParser::command_args; // start of parameters
 #endif
 
+#if ENABLED(PRECOMPILED_GCODE)
+  const precompiled_gcode_t *GCodeParser::precompiled; // = nullptr
+  const float *GCodeParser::value_pre;                 // = nullptr
+#endif
+
 // Create a global instance of the GCode parser singleton
 GCodeParser parser;
 
@@ -84,6 +89,10 @@ void GCodeParser::reset() {
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
+  #if ENABLED(PRECOMPILED_GCODE)
+    precompiled = nullptr;              // Values come from the text
+    value_pre = nullptr;
+  #endif
 }
 
 #if ENABLED(GCODE_QUOTED_STRINGS)
@@ -363,6 +372,65 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(PRECOMPILED_GCODE)
+
+  /**
+   * Parse a line as it's queued and save the result in 'pc', along with the
+   * first PRECOMPILED_GCODE_VALUES numbers. Commands are queued from idle(),
+   * so the parser state of the running command is put back afterward.
+   */
+  void GCodeParser::precompile(char * const line, precompiled_gcode_t &pc) {
+    char * const old_command_ptr = command_ptr, * const old_string_arg = string_arg, * const old_value_ptr = value_ptr;
+    const char old_letter = command_letter;
+    const uint16_t old_codenum = codenum;
+    TERN_(USE_GCODE_SUBCODES, const uint8_t old_subcode = subcode);
+    const uint32_t old_codebits = codebits;
+    uint8_t old_param[COUNT(param)];
+    COPY(old_param, param);
+    const precompiled_gcode_t * const old_precompiled = precompiled;
+    const float * const old_value_pre = value_pre;
+
+    parse(line);
+
+    pc.letter = command_letter == '?' ? '\0' : command_letter; // Unknown commands are parsed again to report them
+    pc.codenum = codenum;
+    TERN_(USE_GCODE_SUBCODES, pc.subcode = subcode);
+    pc.start = command_ptr - line;
+    pc.string_arg = string_arg ? string_arg - line : 0;
+    pc.codebits = codebits;
+    COPY(pc.param, param);
+
+    // Convert values in letter order, as many as will fit
+    pc.valbits = 0;
+    for (uint8_t i = 0, n = 0; i < COUNT(param) && n < PRECOMPILED_GCODE_VALUES; ++i)
+      if (seenval('A' + i)) { pc.value[n++] = value_float(); SBI32(pc.valbits, i); }
+
+    command_ptr = old_command_ptr;
+    string_arg = old_string_arg;
+    value_ptr = old_value_ptr;
+    command_letter = old_letter;
+    codenum = old_codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = old_subcode);
+    codebits = old_codebits;
+    COPY(param, old_param);
+    precompiled = old_precompiled;
+    value_pre = old_value_pre;
+  }
+
+  void GCodeParser::restore(char * const line, const precompiled_gcode_t &pc) {
+    command_ptr = line + pc.start;
+    string_arg = pc.string_arg ? line + pc.string_arg : nullptr;
+    command_letter = pc.letter;
+    codenum = pc.codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = pc.subcode);
+    codebits = pc.codebits;
+    COPY(param, pc.param);
+    precompiled = &pc;
+    value_pre = nullptr;
+  }
+
+#endif // PRECOMPILED_GCODE
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
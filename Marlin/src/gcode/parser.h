@@ -42,6 +42,26 @@
   typedef enum : uint8_t { LINEARUNIT_MM, LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#if ENABLED(PRECOMPILED_GCODE)
+  /**
+   * A command parsed as it was queued. The parser state is restored
+   * from this at dispatch, with the first numbers already converted.
+   */
+  typedef struct {
+    uint32_t codebits,                      // Parameters present
+             valbits;                       // Parameters with a converted value
+    float value[PRECOMPILED_GCODE_VALUES];  // Converted values, in letter order
+    uint16_t codenum,                       // 123
+             string_arg;                    // Offset of the string argument, or 0
+    uint8_t param[26],                      // Value offsets from the command, as in the parser
+            start;                          // Offset of the command, after any line number
+    #if USE_GCODE_SUBCODES
+      uint8_t subcode;                      // .1
+    #endif
+    char letter;                            // G, M, or T. 0 to parse the text at dispatch.
+  } precompiled_gcode_t;
+#endif
+
 /**
  * GCode parser
  *
@@ -66,6 +86,11 @@ private:
     static char *command_args;      // Args start here, for slow scan
   #endif
 
+  #if ENABLED(PRECOMPILED_GCODE)
+    static const precompiled_gcode_t *precompiled;  // The running command, if restored
+    static const float *value_pre;                  // Set by seen, the converted value
+  #endif
+
 public:
 
   // Global states for GCode-level units features
@@ -153,6 +178,11 @@ public:
         }
         else
           value_ptr = nullptr;
+        #if ENABLED(PRECOMPILED_GCODE)
+          value_pre = (precompiled && TEST32(precompiled->valbits, ind))
+            ? &precompiled->value[__builtin_popcountl(precompiled->valbits & (_BV32(ind) - 1))]
+            : nullptr;
+        #endif
       }
       return b;
     }
@@ -239,6 +269,14 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(PRECOMPILED_GCODE)
+    // Parse a line as it's queued, keeping the state of the running command
+    static void precompile(char * const line, precompiled_gcode_t &pc);
+
+    // Set all fields from a precompiled line instead of parsing it again
+    static void restore(char * const line, const precompiled_gcode_t &pc);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -258,6 +296,9 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
+    #if ENABLED(PRECOMPILED_GCODE)
+      if (value_pre) return *value_pre;
+    #endif
     if (value_ptr) {
       char *e = value_ptr;
       for (;;) {
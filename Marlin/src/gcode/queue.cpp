@@ -86,6 +86,19 @@ char GCodeQueue::injected_commands[64]; // = { 0 }
 void GCodeQueue::RingBuffer::commit_command(bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
+  #if ENABLED(GCODE_QUEUE_ARENA)
+    char * const cmd = arena_next();
+    commands[index_w].buffer = cmd;
+    arena_w = cmd + strlen(cmd) + 1;
+  #endif
+  #if ENABLED(PRECOMPILED_GCODE)
+    // Parse it now, unless it's being saved to SD as text
+    CommandLine &command = commands[index_w];
+    if (TERN1(SDSUPPORT, !card.flag.saving))
+      parser.precompile(command.buffer, command.pre);
+    else
+      command.pre.letter = '\0';
+  #endif
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
@@ -100,8 +113,8 @@ void GCodeQueue::RingBuffer::commit_command(bool skip_ok
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(commands[index_w].buffer, cmd);
+  if (*cmd == ';' || full()) return false;
+  strcpy(next_buffer(), cmd);
   commit_command(skip_ok
     #if HAS_MULTI_SERIAL
       , serial_ind
@@ -249,7 +262,7 @@ void GCodeQueue::RingBuffer::ok_to_send() {
         SERIAL_CHAR(*p++);
     }
     SERIAL_ECHOPAIR_P(SP_P_STR, planner.moves_free(),
-                      SP_B_STR, BUFSIZE - length);
+                      SP_B_STR, full() ? 0 : BUFSIZE - length);
   #endif
   SERIAL_EOL();
 }
@@ -311,7 +324,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -367,7 +380,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
   const bool is_empty = (ind == 0);   // An empty line?
@@ -378,6 +391,114 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+#if ENABLED(SERIAL_INPLACE_LINES)
+
+  /**
+   * Frame one line from a serial RX span, writing it straight into a command
+   * buffer. Return the bytes used, including the EOL, or 0 for no complete line.
+   */
+  inline size_t frame_span_line(const uint8_t * const data, const size_t n, char * const buff) {
+    uint8_t sis = PS_NORMAL;
+    int ind = 0;
+    for (size_t i = 0; i < n; i++) {
+      const char c = (char)data[i];
+      if (ISEOL(c)) {
+        process_line_done(sis, buff, ind);
+        return i + 1;
+      }
+      process_stream_char(c, sis, buff, ind);
+    }
+    return 0;
+  }
+
+#endif
+
+/**
+ * Check the line number and checksum of a complete serial line, give a
+ * "stopped" alert for motion, and run critical commands early.
+ * Return false if the line has an error and a resend was requested.
+ */
+bool GCodeQueue::serial_line_ok(char * const line, const serial_index_t p) {
+  SerialState &serial = serial_state[p.index];
+  char* command = line;
+
+  while (*command == ' ') command++;                   // Skip leading spaces
+  char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+
+  if (npos) {
+
+    const bool M110 = !!strstr_P(command, PSTR("M110"));
+
+    if (M110) {
+      char* n2pos = strchr(command + 4, 'N');
+      if (n2pos) npos = n2pos;
+    }
+
+    const long gcode_N = strtol(npos + 1, nullptr, 10);
+
+    if (gcode_N != serial.last_N + 1 && !M110) {
+      // In case of error on a serial port, don't prevent other serial port from making progress
+      gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
+      return false;
+    }
+
+    char *apos = strrchr(command, '*');
+    if (apos) {
+      uint8_t checksum = 0, count = uint8_t(apos - command);
+      while (count) checksum ^= command[--count];
+      if (strtol(apos + 1, nullptr, 10) != checksum) {
+        // In case of error on a serial port, don't prevent other serial port from making progress
+        gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), p);
+        return false;
+      }
+    }
+    else {
+      // In case of error on a serial port, don't prevent other serial port from making progress
+      gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
+      return false;
+    }
+
+    serial.last_N = gcode_N;
+  }
+  #if ENABLED(SDSUPPORT)
+    // Pronterface "M29" and "M29 " has no line number
+    else if (card.flag.saving && !is_M29(command)) {
+      gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
+      return false;
+    }
+  #endif
+
+  //
+  // Movement commands give an alert when the machine is stopped
+  //
+
+  if (IsStopped()) {
+    char* gpos = strchr(command, 'G');
+    if (gpos) {
+      switch (strtol(gpos + 1, nullptr, 10)) {
+        case 0 ... 1:
+        TERN_(ARC_SUPPORT, case 2 ... 3:)
+        TERN_(BEZIER_CURVE_SUPPORT, case 5:)
+          PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+          SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+          LCD_MESSAGEPGM(MSG_STOPPED);
+          break;
+      }
+    }
+  }
+
+  #if DISABLED(EMERGENCY_PARSER)
+    // Process critical commands early
+    if (command[0] == 'M') switch (command[3]) {
+      case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_LCD_MENU, wait_for_user = false); } break;
+      case '2': if (command[2] == '1' && command[1] == '1') kill(M112_KILL_STR, nullptr, true); break;
+      case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
+    }
+  #endif
+
+  return true;
+}
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -421,6 +542,40 @@ void GCodeQueue::get_serial_commands() {
       // Ok, we have some data to process, let's make progress here
       hadData = true;
 
+      SerialState &serial = serial_state[p];
+
+      #if ENABLED(SERIAL_INPLACE_LINES)
+        // Between lines, take a whole line in place from the RX buffer
+        // and write it only once, into the next command slot
+        if (serial.count == 0 && serial.input_state == PS_NORMAL) {
+          const uint8_t *data;
+          const size_t n = SERIAL_IMPL.rx_span(p, &data);
+          char * const buff = ring_buffer.next_buffer();
+          const size_t used = n ? frame_span_line(data, n, buff) : 0;
+          if (used) {
+            SERIAL_IMPL.rx_consume(p, used);      // Before a line error flushes the RX buffer
+
+            if (buff[0] == '\0') continue;        // Skip an empty line
+
+            // Validate the line and handle critical commands. Stop on error.
+            if (!serial_line_ok(buff, p)) break;
+
+            #if NO_TIMEOUTS > 0
+              last_command_time = ms;
+            #endif
+
+            // Add the command to the queue
+            ring_buffer.commit_command(false
+              #if HAS_MULTI_SERIAL
+                , p
+              #endif
+            );
+            continue;
+          }
+          // Otherwise the line is incomplete or wraps, so read it by character
+        }
+      #endif
+
       const int c = read_serial(p);
       if (c < 0) {
         // This should never happen, let's log it
@@ -433,7 +588,6 @@ void GCodeQueue::get_serial_commands() {
       }
 
       const char serial_char = (char)c;
-      SerialState &serial = serial_state[p];
 
       if (ISEOL(serial_char)) {
 
@@ -441,81 +595,8 @@ void GCodeQueue::get_serial_commands() {
         if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
           continue;
 
-        char* command = serial.line_buffer;
-
-        while (*command == ' ') command++;                   // Skip leading spaces
-        char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
-
-        if (npos) {
-
-          const bool M110 = !!strstr_P(command, PSTR("M110"));
-
-          if (M110) {
-            char* n2pos = strchr(command + 4, 'N');
-            if (n2pos) npos = n2pos;
-          }
-
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
-
-          if (gcode_N != serial.last_N + 1 && !M110) {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
-            break;
-          }
-
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
-              // In case of error on a serial port, don't prevent other serial port from making progress
-              gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), p);
-              break;
-            }
-          }
-          else {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-
-          serial.last_N = gcode_N;
-        }
-        #if ENABLED(SDSUPPORT)
-          // Pronterface "M29" and "M29 " has no line number
-          else if (card.flag.saving && !is_M29(command)) {
-            gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-        #endif
-
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0 ... 1:
-              TERN_(ARC_SUPPORT, case 2 ... 3:)
-              TERN_(BEZIER_CURVE_SUPPORT, case 5:)
-                PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGEPGM(MSG_STOPPED);
-                break;
-            }
-          }
-        }
-
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (command[0] == 'M') switch (command[3]) {
-            case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_LCD_MENU, wait_for_user = false); } break;
-            case '2': if (command[2] == '1' && command[1] == '1') kill(M112_KILL_STR, nullptr, true); break;
-            case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
-          }
-        #endif
+        // Validate the line and handle critical commands. Stop on error.
+        if (!serial_line_ok(serial.line_buffer, p)) break;
 
         #if NO_TIMEOUTS > 0
           last_command_time = ms;
@@ -555,22 +636,22 @@ void GCodeQueue::get_serial_commands() {
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
-      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+      char * const command = ring_buffer.next_buffer();
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
+        if (!process_line_done(sd_input_state, command, sd_count)) {
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
-          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
+          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command));
 
           #if DISABLED(PARK_HEAD_ON_PAUSE)
             // When M25 is non-blocking it can still suspend SD commands
             // Otherwise the M125 handler needs to know SD printing is active
-            if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
+            if (command[0] == 'M' && command[1] == '2' && command[2] == '5' && !NUMERIC(command[3]))
               card.pauseSDPrint();
           #endif
 
@@ -584,7 +665,7 @@ void GCodeQueue::get_serial_commands() {
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
+        process_stream_char(sd_char, sd_input_state, command, sd_count);
     }
   }
 
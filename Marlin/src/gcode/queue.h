@@ -28,6 +28,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(PRECOMPILED_GCODE)
+  #include "parser.h"
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -50,6 +54,8 @@ public:
   /**
    * GCode Command Queue
    * A simple (circular) ring buffer of BUFSIZE command strings.
+   * With GCODE_QUEUE_ARENA the strings are stored end to end in one
+   * circular arena, and each command just points to its string.
    *
    * Commands are copied into this buffer by the command injectors
    * (immediate, serial, sd card) and they are processed sequentially by
@@ -57,8 +63,15 @@ public:
    * command and hands off execution to individual handler functions.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    #if ENABLED(GCODE_QUEUE_ARENA)
+      char *buffer;                 //!< The command string, in the arena
+    #else
+      char buffer[MAX_CMD_SIZE];    //!< The command buffer
+    #endif
     bool skip_ok;                   //!< Skip sending ok when command is processed?
+    #if ENABLED(PRECOMPILED_GCODE)
+      precompiled_gcode_t pre;      //!< The command as parsed when queued
+    #endif
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
     #endif
@@ -73,6 +86,26 @@ public:
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
+    #if ENABLED(GCODE_QUEUE_ARENA)
+      char *arena_w;                        //!< The end of the newest command string
+      char arena[GCODE_QUEUE_ARENA_SIZE];   //!< Command strings, oldest at commands[index_r]
+
+      /**
+       * Get the place for the next command string, with room for MAX_CMD_SIZE,
+       * or nullptr if there's no room. Keep a gap so arena_w never meets the oldest string.
+       */
+      inline char* arena_next() const {
+        char * const a = const_cast<char*>(arena);
+        if (!length) return a;
+        const char * const r = commands[index_r].buffer;
+        if (arena_w > r) {                                        // Not wrapped: room at the end or the start
+          if (a + GCODE_QUEUE_ARENA_SIZE - arena_w >= MAX_CMD_SIZE) return arena_w;
+          return r - a > MAX_CMD_SIZE ? a : nullptr;
+        }
+        return r - arena_w > MAX_CMD_SIZE ? arena_w : nullptr;    // Wrapped: room up to the oldest
+      }
+    #endif
+
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
     inline void clear() { length = index_r = index_w = 0; }
@@ -89,7 +122,10 @@ public:
 
     void ok_to_send();
 
-    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount) || TERN0(GCODE_QUEUE_ARENA, !arena_next()); }
+
+    // The buffer for the next command to commit. Check full() first.
+    inline char* next_buffer() { return TERN(GCODE_QUEUE_ARENA, arena_next(), commands[index_w].buffer); }
 
     inline bool occupied() const { return length != 0; }
 
@@ -201,6 +237,9 @@ private:
 
   static void get_serial_commands();
 
+  // Check and preprocess a complete serial line
+  static bool serial_line_ok(char * const line, const serial_index_t p);
+
   #if ENABLED(SDSUPPORT)
     static void get_sdcard_commands();
   #endif
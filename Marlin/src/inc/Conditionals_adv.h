@@ -561,6 +561,20 @@
   #endif
 #endif
 
+// Flag whether cycle_counter.cpp is used
+#if EITHER(PLANNER_BENCHMARK, STEPPER_ISR_PROFILE)
+  #define HAS_CYCLE_STATS 1
+#endif
+
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #define HAS_SHAPING 1
+#endif
+
+// Track the time of the moves in the planner
+#if HAS_WIRED_LCD || ENABLED(PLANNER_BUFFER_TIME)
+  #define HAS_BLOCK_RUNTIME 1
+#endif
+
 // Flag whether least_squares_fit.cpp is used
 #if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, Z_STEPPER_ALIGN_KNOWN_STEPPER_POSITIONS)
   #define NEED_LSF 1
@@ -678,6 +678,27 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 #elif ANY(SERIAL_XON_XOFF, SERIAL_STATS_MAX_RX_QUEUED, SERIAL_STATS_DROPPED_RX)
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
+#if ENABLED(PRECOMPILED_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "PRECOMPILED_GCODE requires FASTER_GCODE_PARSER."
+  #elif ENABLED(GCODE_MOTION_MODES)
+    #error "PRECOMPILED_GCODE is not compatible with GCODE_MOTION_MODES."
+  #elif !WITHIN(PRECOMPILED_GCODE_VALUES, 1, 26)
+    #error "PRECOMPILED_GCODE_VALUES must be from 1 to 26."
+  #endif
+#endif
+
+#if BUFSIZE > 255
+  #error "BUFSIZE must be 255 or less."
+#elif ENABLED(GCODE_QUEUE_ARENA) && GCODE_QUEUE_ARENA_SIZE <= 2 * (MAX_CMD_SIZE)
+  #error "GCODE_QUEUE_ARENA_SIZE must be more than 2 * MAX_CMD_SIZE."
+#endif
+#if ENABLED(SERIAL_DMA_RX) && !defined(__STM32F1__)
+  #error "SERIAL_DMA_RX is only available for STM32F1 (Maple)."
+#endif
+#if ENABLED(SERIAL_INPLACE_LINES) && !(ENABLED(SERIAL_DMA_RX) || defined(__PLAT_LINUX__))
+  #error "SERIAL_INPLACE_LINES requires SERIAL_DMA_RX or LINUX native."
+#endif
 
 /**
  * Multiple Stepper Drivers Per Axis
@@ -902,6 +923,14 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
       static_assert(BABYSTEP_MULTIPLICATOR_XY <= 0.25f, "BABYSTEP_MULTIPLICATOR_XY must be less than or equal to 0.25mm.");
     #endif
   #endif
+  #if ENABLED(BABYSTEP_SMOOTHING)
+    #if DISABLED(INTEGRATED_BABYSTEPPING)
+      #error "BABYSTEP_SMOOTHING requires INTEGRATED_BABYSTEPPING."
+    #elif defined(__AVR__)
+      #error "BABYSTEP_SMOOTHING requires a 32-bit MCU."
+    #endif
+    static_assert(WITHIN(BABYSTEP_SMOOTH_TIME, 0.001, 1), "BABYSTEP_SMOOTH_TIME must be from 0.001 to 1 seconds.");
+  #endif
 #endif
 
 /**
@@ -1204,13 +1233,21 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     WITHIN(LIN_ADVANCE_K, 0, 10),
     "LIN_ADVANCE_K must be a value from 0 to 10 (Changed in LIN_ADVANCE v1.5, Marlin 1.1.9)."
   );
-  #if ENABLED(S_CURVE_ACCELERATION) && DISABLED(EXPERIMENTAL_SCURVE)
-    #error "LIN_ADVANCE and S_CURVE_ACCELERATION may not play well together! Enable EXPERIMENTAL_SCURVE to continue."
+  #if ENABLED(S_CURVE_ACCELERATION) && NONE(EXPERIMENTAL_SCURVE, LA_PRESSURE_PROFILE)
+    #error "LIN_ADVANCE and S_CURVE_ACCELERATION may not play well together! Enable EXPERIMENTAL_SCURVE or LA_PRESSURE_PROFILE to continue."
   #elif ENABLED(DIRECT_STEPPING)
     #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. Enable in external planner if possible."
   #elif !HAS_JUNCTION_DEVIATION && defined(DEFAULT_EJERK)
     static_assert(DEFAULT_EJERK >= 10, "It is strongly recommended to set DEFAULT_EJERK >= 10 when using LIN_ADVANCE.");
   #endif
+  #if ENABLED(LA_PRESSURE_PROFILE)
+    #ifdef __AVR__
+      #error "LA_PRESSURE_PROFILE requires a 32-bit MCU."
+    #endif
+    static_assert(WITHIN(LA_SMOOTH_TIME, 0, 0.2), "LA_SMOOTH_TIME must be from 0 to 0.2 seconds.");
+  #endif
+#elif ENABLED(LA_PRESSURE_PROFILE)
+  #error "LA_PRESSURE_PROFILE requires LIN_ADVANCE."
 #endif
 
 /**
@@ -2455,6 +2492,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "ENDSTOP_NOISE_THRESHOLD must be an integer from 2 to 7."
 #endif
 
+#if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+  #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    #error "ENDSTOP_EDGE_TIMESTAMPS requires ENDSTOP_INTERRUPTS_FEATURE."
+  #elif ENDSTOP_NOISE_THRESHOLD
+    #error "ENDSTOP_EDGE_TIMESTAMPS is incompatible with ENDSTOP_NOISE_THRESHOLD."
+  #elif !(defined(__STM32F1__) || defined(TARGET_STM32F1) || defined(__PLAT_LINUX__))
+    #error "ENDSTOP_EDGE_TIMESTAMPS is only available for STM32F1 (Maple) and LINUX."
+  #endif
+#endif
+
 /**
  * Emergency Command Parser
  */
@@ -3294,6 +3341,132 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel."
 #endif
 
+#if ENABLED(STEP_TIMING_TABLE)
+  #ifdef __AVR__
+    #error "STEP_TIMING_TABLE requires a 32-bit MCU."
+  #elif !IS_POWER_OF_2(STEP_TIMING_BLOCKS) || !WITHIN(STEP_TIMING_BLOCKS, 2, BLOCK_BUFFER_SIZE)
+    #error "STEP_TIMING_BLOCKS must be a power of 2 from 2 to BLOCK_BUFFER_SIZE."
+  #elif !WITHIN(STEP_TIMING_TABLE_SIZE, 1, 255)
+    #error "STEP_TIMING_TABLE_SIZE must be from 1 to 255."
+  #elif ENABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
+    #error "STEP_TIMING_TABLE is not compatible with LASER_POWER_INLINE_TRAPEZOID_CONT."
+  #endif
+#endif
+
+#if HAS_SHAPING
+  #ifdef __AVR__
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y require a 32-bit MCU."
+  #elif !IS_CARTESIAN
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y currently require a Cartesian machine."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y are not compatible with DIRECT_STEPPING."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y are not compatible with I2S_STEPPER_STREAM."
+  #elif ENABLED(INPUT_SHAPING_X) && !WITHIN(SHAPING_TYPE_X, 0, 2)
+    #error "SHAPING_TYPE_X must be 0 (ZV), 1 (ZVD) or 2 (MZV)."
+  #elif ENABLED(INPUT_SHAPING_Y) && !WITHIN(SHAPING_TYPE_Y, 0, 2)
+    #error "SHAPING_TYPE_Y must be 0 (ZV), 1 (ZVD) or 2 (MZV)."
+  #endif
+  static_assert(SHAPING_MIN_FREQ > 0, "SHAPING_MIN_FREQ must be greater than 0.");
+  #if ENABLED(INPUT_SHAPING_X)
+    static_assert(SHAPING_FREQ_X == 0 || SHAPING_FREQ_X >= SHAPING_MIN_FREQ, "SHAPING_FREQ_X must be 0 or at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.5), "SHAPING_ZETA_X must be from 0.0 to 0.5.");
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    static_assert(SHAPING_FREQ_Y == 0 || SHAPING_FREQ_Y >= SHAPING_MIN_FREQ, "SHAPING_FREQ_Y must be 0 or at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_Y, 0, 0.5), "SHAPING_ZETA_Y must be from 0.0 to 0.5.");
+  #endif
+#endif
+
+#if ENABLED(PLANNER_BUFFER_TIME)
+  #ifdef __AVR__
+    #error "PLANNER_BUFFER_TIME requires a 32-bit MCU."
+  #elif PLANNER_BUFFER_TIME_MAX && PLANNER_BUFFER_TIME_MAX <= PLANNER_BUFFER_TIME_MIN
+    #error "PLANNER_BUFFER_TIME_MAX must be 0 or greater than PLANNER_BUFFER_TIME_MIN."
+  #elif PLANNER_BUFFER_TIME_MAX > 60000
+    #error "PLANNER_BUFFER_TIME_MAX must be 60000 (ms) or less."
+  #endif
+#endif
+
+#if ENABLED(CORNER_BLENDING)
+  #if IS_KINEMATIC
+    #error "CORNER_BLENDING requires a Cartesian or Core machine."
+  #elif LINEAR_AXES != 3
+    #error "CORNER_BLENDING requires exactly 3 linear axes."
+  #endif
+  static_assert(WITHIN(CORNER_BLENDING_MAX_ANGLE, 1, 90), "CORNER_BLENDING_MAX_ANGLE must be from 1 to 90.");
+  static_assert(CORNER_BLENDING_TOLERANCE >= 0, "CORNER_BLENDING_TOLERANCE must be 0 or greater.");
+#endif
+
+#if ENABLED(SEGMENT_MERGING)
+  #if IS_KINEMATIC
+    #error "SEGMENT_MERGING requires a Cartesian or Core machine."
+  #elif !WITHIN(SEGMENT_MERGING_MAX_SEGMENTS, 2, 32)
+    #error "SEGMENT_MERGING_MAX_SEGMENTS must be from 2 to 32."
+  #endif
+  static_assert(SEGMENT_MERGING_TOLERANCE >= 0, "SEGMENT_MERGING_TOLERANCE must be 0 or greater.");
+  static_assert(WITHIN(SEGMENT_MERGING_MAX_ANGLE, 0, 45), "SEGMENT_MERGING_MAX_ANGLE must be from 0 to 45.");
+  static_assert(WITHIN(SEGMENT_MERGING_E_TOLERANCE, 0, 1), "SEGMENT_MERGING_E_TOLERANCE must be from 0 to 1.");
+#endif
+
+#if ENABLED(INCREMENTAL_IK)
+  #if !IS_KINEMATIC
+    #error "INCREMENTAL_IK requires a DELTA or SCARA machine."
+  #elif !WITHIN(INCREMENTAL_IK_SPAN, 2, 32)
+    #error "INCREMENTAL_IK_SPAN must be from 2 to 32."
+  #endif
+#endif
+
+#if ENABLED(UBL_CELL_CACHE)
+  #if DISABLED(AUTO_BED_LEVELING_UBL)
+    #error "UBL_CELL_CACHE requires AUTO_BED_LEVELING_UBL."
+  #elif !UBL_SEGMENTED
+    #error "UBL_CELL_CACHE requires UBL segmented moves (DELTA)."
+  #endif
+#endif
+
+#if ENABLED(ABL_BICUBIC)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ABL_BICUBIC requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "ABL_BICUBIC can't be used with ABL_BILINEAR_SUBDIVISION."
+  #elif IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+    #error "ABL_BICUBIC requires SEGMENT_LEVELED_MOVES on Cartesian machines."
+  #endif
+#endif
+
+#ifdef ARC_CHORD_TOLERANCE
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_CHORD_TOLERANCE requires ARC_SUPPORT."
+  #elif defined(ARC_SEGMENTS_PER_R) || defined(ARC_SEGMENTS_PER_SEC)
+    #error "ARC_CHORD_TOLERANCE can't be used with ARC_SEGMENTS_PER_R or ARC_SEGMENTS_PER_SEC."
+  #endif
+  static_assert(ARC_CHORD_TOLERANCE > 0, "ARC_CHORD_TOLERANCE must be greater than 0.");
+#endif
+
+#ifdef BEZIER_CURVE_TOLERANCE
+  #if DISABLED(BEZIER_CURVE_SUPPORT)
+    #error "BEZIER_CURVE_TOLERANCE requires BEZIER_CURVE_SUPPORT."
+  #endif
+  static_assert(BEZIER_CURVE_TOLERANCE > 0, "BEZIER_CURVE_TOLERANCE must be greater than 0.");
+#endif
+
+#if ENABLED(ARC_BLOCKS)
+  #ifdef __AVR__
+    #error "ARC_BLOCKS requires a 32-bit MCU."
+  #elif !IS_FULL_CARTESIAN || ENABLED(MARKFORGED_XY)
+    #error "ARC_BLOCKS requires a Cartesian machine."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "ARC_BLOCKS is incompatible with SKEW_CORRECTION."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "ARC_BLOCKS is incompatible with BACKLASH_COMPENSATION."
+  #elif ENABLED(DUAL_X_CARRIAGE)
+    #error "ARC_BLOCKS is incompatible with DUAL_X_CARRIAGE."
+  #elif HAS_CLASSIC_JERK
+    #error "ARC_BLOCKS requires Junction Deviation. Disable CLASSIC_JERK."
+  #endif
+#endif
+
 #if ENABLED(LED_CONTROL_MENU) && !IS_ULTIPANEL
   #error "LED_CONTROL_MENU requires an LCD controller."
 #endif
@@ -3404,6 +3577,20 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
 #endif
 
+#if ENABLED(BACKLASH_STREAM)
+  #if DISABLED(BACKLASH_COMPENSATION)
+    #error "BACKLASH_STREAM requires BACKLASH_COMPENSATION."
+  #elif defined(BACKLASH_SMOOTHING_MM)
+    #error "BACKLASH_STREAM is incompatible with BACKLASH_SMOOTHING_MM."
+  #elif HAS_SHAPING
+    #error "BACKLASH_STREAM is incompatible with INPUT_SHAPING_X and INPUT_SHAPING_Y."
+  #elif LINEAR_AXES > 3
+    #error "BACKLASH_STREAM only supports the X, Y, and Z axes."
+  #elif !defined(BACKLASH_STREAM_RATE) || !WITHIN(BACKLASH_STREAM_RATE, 100, 50000)
+    #error "BACKLASH_STREAM_RATE must be between 100 and 50000 steps/s."
+  #endif
+#endif
+
 #if ENABLED(GRADIENT_MIX) && MIXING_VIRTUAL_TOOLS < 2
   #error "GRADIENT_MIX requires 2 or more MIXING_VIRTUAL_TOOLS."
 #endif
@@ -872,6 +872,8 @@ namespace ExtUI {
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           Z_VALUES(pos.x, pos.y) = zoff;
           TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+          TERN_(ABL_BICUBIC, bed_level_bicubic_refresh());
+          TERN_(UBL_CELL_CACHE, ubl.refresh_cells());
         }
       }
 
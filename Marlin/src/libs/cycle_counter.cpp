@@ -0,0 +1,40 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if HAS_CYCLE_STATS
+
+#include "cycle_counter.h"
+
+void CycleStats::report(PGM_P const label, const bool show_hist/*=true*/) const {
+  SERIAL_ECHOPGM_P(label);
+  if (!count) { SERIAL_ECHOLNPGM(" (no samples)"); return; }
+  SERIAL_ECHOLNPAIR(" n:", count, " min:", min, " avg:", avg(), " max:", max, " cycles (max ", cycles_to_us(max), "us)");
+  if (show_hist) {
+    SERIAL_ECHOPGM("  log2 hist:");
+    LOOP_L_N(i, CYCLE_STATS_BINS) if (hist[i]) SERIAL_ECHOPAIR(" 2^", i, ":", hist[i]);
+    SERIAL_EOL();
+  }
+}
+
+#endif // HAS_CYCLE_STATS
@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * cycle_counter.h - Cheap CPU cycle timestamps and min/avg/max/histogram
+ *                   accumulators for profiling hot code paths.
+ *
+ *  - Cortex-M reads the DWT cycle counter (enabled by calibrate_delay_loop)
+ *  - Native (HAL/LINUX) scales clock_gettime(CLOCK_MONOTONIC) to F_CPU
+ *  - Other platforms fall back to micros() scaled to F_CPU
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifdef __PLAT_LINUX__
+  #include <time.h>
+#endif
+
+#ifndef CYCLE_STATS_BINS
+  #define CYCLE_STATS_BINS 24   // log2 buckets: 1, 2, 4 ... 2^23+ cycles
+#endif
+
+#if defined(__arm__) || defined(__thumb__)
+  FORCE_INLINE uint32_t cycle_count() { return *(volatile uint32_t *)0xE0001004; } // DWT_CYCCNT
+#elif defined(__PLAT_LINUX__)
+  FORCE_INLINE uint32_t cycle_count() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint32_t(uint64_t(ts.tv_sec) * (F_CPU) + uint64_t(ts.tv_nsec) * ((F_CPU) / 1000000UL) / 1000UL);
+  }
+#else
+  FORCE_INLINE uint32_t cycle_count() { return micros() * ((F_CPU) / 1000000UL); }
+#endif
+
+// Convert a cycle count to microseconds
+FORCE_INLINE uint32_t cycles_to_us(const uint32_t cycles) { return cycles / ((F_CPU) / 1000000UL); }
+
+typedef struct CycleStats {
+  uint32_t count, min, max;
+  uint64_t total;
+  uint32_t hist[CYCLE_STATS_BINS];        // 32-bit, so ISR-rate sampling doesn't saturate
+
+  void reset() { count = max = 0; min = UINT32_MAX; total = 0; ZERO(hist); }
+
+  // Record one sample. Cheap enough for ISR context.
+  void record(const uint32_t cycles) {
+    count++;
+    total += cycles;
+    NOMORE(min, cycles);
+    NOLESS(max, cycles);
+    uint8_t bin = cycles ? 31 - __builtin_clz(cycles) : 0;
+    NOMORE(bin, CYCLE_STATS_BINS - 1);
+    if (hist[bin] < UINT32_MAX) hist[bin]++;
+  }
+
+  uint32_t avg() const { return count ? uint32_t(total / count) : 0; }
+
+  // Print "<label> n:... min:... avg:... max:... (cycles)" followed by the non-empty histogram bins
+  void report(PGM_P const label, const bool show_hist=true) const;
+
+} cycle_stats_t;
@@ -35,6 +35,10 @@
   #include HAL_PATH(../HAL, endstop_interrupts.h)
 #endif
 
+#if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+  #include "../libs/cycle_counter.h"
+#endif
+
 #if BOTH(SD_ABORT_ON_ENDSTOP_HIT, SDSUPPORT)
   #include "printcounter.h" // for print_job_timer
 #endif
@@ -58,6 +62,11 @@ Endstops endstops;
 bool Endstops::enabled, Endstops::enabled_globally; // Initialized by settings.load()
 
 volatile Endstops::endstop_mask_t Endstops::hit_state;
+
+#if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+  volatile uint32_t Endstops::edge_cycles;
+  volatile bool Endstops::at_edge; // = false
+#endif
 Endstops::endstop_mask_t Endstops::live_state = 0;
 
 #if ENDSTOP_NOISE_THRESHOLD
@@ -364,6 +373,18 @@ void Endstops::poll() {
   #endif
 }
 
+#if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+
+  // The Stepper places a triggering edge among its step events with edge_cycles
+  void Endstops::edge_update() {
+    edge_cycles = cycle_count();
+    at_edge = true;
+    update();
+    at_edge = false;
+  }
+
+#endif
+
 void Endstops::enable_globally(const bool onoff) {
   enabled_globally = enabled = onoff;
   resync();
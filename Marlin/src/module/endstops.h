@@ -148,6 +148,16 @@ class Endstops {
      */
     static void update();
 
+    #if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+      /**
+       * Stamp an endstop edge with the cycle counter, then update.
+       * Called from the endstop pin interrupt.
+       */
+      static volatile uint32_t edge_cycles;
+      static volatile bool at_edge;             // Set while update() runs for a stamped edge
+      static void edge_update();
+    #endif
+
     /**
      * Get Endstop hit state.
      */
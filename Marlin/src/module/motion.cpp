@@ -71,6 +71,10 @@
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(INCREMENTAL_IK)
+  #include "../feature/incremental_ik.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -979,12 +983,24 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // Get the current position as starting point
     xyze_pos_t raw = current_position;
 
+    #if ENABLED(INCREMENTAL_IK)
+      // Interpolate the joint positions between occasional exact solutions
+      const bool interpolate = incremental_ik.begin(raw, segment_distance, segments);
+      abce_pos_t joints;
+    #endif
+
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
     while (--segments) {
       segment_idle(next_idle_ms);
       raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration))) break;
+      #if ENABLED(INCREMENTAL_IK)
+        if (interpolate) incremental_ik.next(joints);
+      #endif
+      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
+        OPTARG(SCARA_FEEDRATE_SCALING, inv_duration)
+        OPTARG(INCREMENTAL_IK, interpolate ? &joints : nullptr)
+      )) break;
     }
 
     // Ensure last segment arrives at target location.
@@ -111,6 +111,23 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(SEGMENT_MERGING)
+  #include "../feature/segment_merge.h"
+#endif
+
+#if ENABLED(CORNER_BLENDING)
+  #include "../feature/corner_blend.h"
+#endif
+
+#if ENABLED(PLANNER_BENCHMARK)
+  #include "../feature/planner_bench.h"
+  #define BENCH_PROBE(S) PlannerBench::Probe bench_probe(PlannerBench::S)
+  #define BENCH_COUNT(C,N) PlannerBench::count(PlannerBench::C, N)
+#else
+  #define BENCH_PROBE(S) NOOP
+  #define BENCH_COUNT(C,N) NOOP
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -123,6 +140,7 @@ Planner planner;
  * A ring buffer of moves described in steps
  */
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
+block_plan_t Planner::block_plan[BLOCK_BUFFER_SIZE];
 volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
                  Planner::block_buffer_nonbusy, // Index of the first non-busy block
                  Planner::block_buffer_planned, // Index of the optimally planned block
@@ -212,6 +230,10 @@ uint32_t Planner::acceleration_long_cutoff;
 xyze_float_t Planner::previous_speed;
 float Planner::previous_nominal_speed_sqr;
 
+#if ENABLED(PLANNER_INCREMENTAL_RECALC)
+  uint8_t Planner::block_buffer_dirty;
+#endif
+
 #if ENABLED(DISABLE_INACTIVE_EXTRUDER)
   last_move_t Planner::g_uc_extruder_last_move[E_STEPPERS] = { 0 };
 #endif
@@ -234,10 +256,17 @@ float Planner::previous_nominal_speed_sqr;
   xyze_pos_t Planner::position_cart;
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
+#if ENABLED(PLANNER_BUFFER_TIME)
+  uint16_t Planner::buffer_time_min_ms = PLANNER_BUFFER_TIME_MIN,
+           Planner::buffer_time_max_ms = PLANNER_BUFFER_TIME_MAX;
+  uint32_t Planner::buffer_time_low_us = UINT32_MAX,
+           Planner::buffer_slowdowns; // = 0
+#endif
+
 /**
  * Class and Instance Methods
  */
@@ -703,13 +732,6 @@ void Planner::init() {
       // Return the result
       return r11 | (uint16_t(r12) << 8) | (uint32_t(r13) << 16);
     }
-  #else
-    // All other 32-bit MPUs can easily do inverse using hardware division,
-    // so we don't need to reduce precision or to use assembly language at all.
-    // This routine, for all other archs, returns 0x100000000 / d ~= 0xFFFFFFFF / d
-    static FORCE_INLINE uint32_t get_period_inverse(const uint32_t d) {
-      return d ? 0xFFFFFFFF / d : 0xFFFFFFFF;
-    }
   #endif
 #endif
 
@@ -746,7 +768,7 @@ block_t* Planner::get_current_block() {
     if (TEST(block->flag, BLOCK_BIT_RECALCULATE)) return nullptr;
 
     // We can't be sure how long an active block will take, so don't count it.
-    TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
+    TERN_(HAS_BLOCK_RUNTIME, block_buffer_runtime_us -= plan_of(block).segment_time_us);
 
     // As this block is busy, advance the nonbusy block pointer
     block_buffer_nonbusy = next_block_index(block_buffer_tail);
@@ -760,7 +782,7 @@ block_t* Planner::get_current_block() {
   }
 
   // The queue became empty
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+  TERN_(HAS_BLOCK_RUNTIME, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
 
   return nullptr;
 }
@@ -777,6 +799,9 @@ block_t* Planner::get_current_block() {
  */
 void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
 
+  // Any prepared step timing is stale now
+  TERN_(STEP_TIMING_TABLE, CBI(block->flag, BLOCK_BIT_STEP_TIMING));
+
   uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
            final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
 
@@ -788,11 +813,17 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
     uint32_t cruise_rate = initial_rate;
   #endif
 
-  const int32_t accel = block->acceleration_steps_per_s2;
+  const int32_t accel = plan_of(block).acceleration_steps_per_s2;
 
+  #if ENABLED(FIXED_POINT_TRAPEZOID)
+          // Steps required for acceleration, deceleration to/from nominal rate
+    uint32_t accelerate_steps = _MAX(estimate_acceleration_steps(initial_rate, block->nominal_rate, accel, true), 0),
+             decelerate_steps = _MAX(estimate_acceleration_steps(final_rate, block->nominal_rate, accel, false), 0);
+  #else
           // Steps required for acceleration, deceleration to/from nominal rate
-  uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
-           decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+    uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
+             decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+  #endif
           // Steps between acceleration and deceleration, if any
   int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
 
@@ -801,13 +832,18 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   // Use intersection_distance() to calculate accel / braking time in order to
   // reach the final_rate exactly at the end of this block.
   if (plateau_steps < 0) {
-    const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
-    accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+    #if ENABLED(FIXED_POINT_TRAPEZOID)
+      const int32_t accelerate_steps_int = intersection_steps(initial_rate, final_rate, accel, block->step_event_count);
+      accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_int, 0)), block->step_event_count);
+    #else
+      const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
+      accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+    #endif
     plateau_steps = 0;
 
     #if ENABLED(S_CURVE_ACCELERATION)
       // We won't reach the cruising rate. Let's calculate the speed we will reach
-      cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      cruise_rate = TERN(FIXED_POINT_TRAPEZOID, final_rate_after, final_speed)(initial_rate, accel, accelerate_steps);
     #endif
   }
   #if ENABLED(S_CURVE_ACCELERATION)
@@ -817,11 +853,8 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
 
   #if ENABLED(S_CURVE_ACCELERATION)
     // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-             deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
-    // And to offload calculations from the ISR, we also calculate the inverse of those times here
-             acceleration_time_inverse = get_period_inverse(acceleration_time),
-             deceleration_time_inverse = get_period_inverse(deceleration_time);
+    const uint32_t acceleration_time = TERN(FIXED_POINT_TRAPEZOID, rate_change_ticks(cruise_rate - initial_rate, accel), ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE)),
+                   deceleration_time = TERN(FIXED_POINT_TRAPEZOID, rate_change_ticks(cruise_rate - final_rate, accel), ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE));
   #endif
 
   // Store new block parameters
@@ -831,8 +864,10 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   #if ENABLED(S_CURVE_ACCELERATION)
     block->acceleration_time = acceleration_time;
     block->deceleration_time = deceleration_time;
-    block->acceleration_time_inverse = acceleration_time_inverse;
-    block->deceleration_time_inverse = deceleration_time_inverse;
+    #ifdef __AVR__
+      block->acceleration_time_inverse = get_period_inverse(acceleration_time);
+      block->deceleration_time_inverse = get_period_inverse(deceleration_time);
+    #endif
     block->cruise_rate = cruise_rate;
   #endif
   block->final_rate = final_rate;
@@ -942,17 +977,20 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
 */
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void Planner::reverse_pass_kernel(block_t * const current, const block_t * const next) {
+// Return 'true' if the entry speed of the block was changed.
+bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const next) {
   if (current) {
+    block_plan_t &cur = plan_of(current);
+
     // If entry speed is already at the maximum entry speed, and there was no change of speed
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
     // compute anything for this block,
     // If not, block entry speed needs to be recalculated to ensure maximum possible planned speed.
-    const float max_entry_speed_sqr = current->max_entry_speed_sqr;
+    const float max_entry_speed_sqr = cur.max_entry_speed_sqr;
 
     // Compute maximum entry speed decelerating over the current block from its exit speed.
     // If not at the maximum entry speed, or the previous block entry speed changed
-    if (current->entry_speed_sqr != max_entry_speed_sqr || (next && TEST(next->flag, BLOCK_BIT_RECALCULATE))) {
+    if (cur.entry_speed_sqr != max_entry_speed_sqr || (next && TEST(next->flag, BLOCK_BIT_RECALCULATE))) {
 
       // If nominal length true, max junction speed is guaranteed to be reached.
       // If a block can de/ac-celerate from nominal speed to zero within the length of the block, then
@@ -964,8 +1002,8 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
 
       const float new_entry_speed_sqr = TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH)
         ? max_entry_speed_sqr
-        : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next ? next->entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED)), current->millimeters));
-      if (current->entry_speed_sqr != new_entry_speed_sqr) {
+        : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-cur.acceleration, next ? plan_of(next).entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED)), cur.millimeters));
+      if (cur.entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
         // ISR does not consume the block before being recalculated
@@ -982,11 +1020,13 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
         else {
           // Block is not BUSY so this is ahead of the Stepper ISR:
           // Just Set the new entry speed.
-          current->entry_speed_sqr = new_entry_speed_sqr;
+          cur.entry_speed_sqr = new_entry_speed_sqr;
+          return true;
         }
       }
     }
   }
+  return false;
 }
 
 /**
@@ -994,6 +1034,8 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
  * Once in reverse and once forward. This implements the reverse pass.
  */
 void Planner::reverse_pass() {
+  BENCH_PROBE(REVERSE_PASS);
+
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = prev_block_index(block_buffer_head);
 
@@ -1006,6 +1048,13 @@ void Planner::reverse_pass() {
   //  planning already consumed blocks
   if (planned_block_index == block_buffer_head) return;
 
+  BENCH_COUNT(REVERSE_FULL, BLOCK_MOD(block_index - planned_block_index));
+
+  #if ENABLED(PLANNER_INCREMENTAL_RECALC)
+    // Unless the pass stops early this is where the forward pass begins
+    block_buffer_dirty = planned_block_index;
+  #endif
+
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
   // NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
@@ -1017,7 +1066,18 @@ void Planner::reverse_pass() {
 
     // Only consider non sync-and-page blocks
     if (!(current->flag & BLOCK_MASK_SYNC) && !IS_PAGE(current)) {
-      reverse_pass_kernel(current, next);
+      BENCH_COUNT(REVERSE_KERNELS, 1);
+      #if ENABLED(PLANNER_INCREMENTAL_RECALC)
+        // The speeds have converged if the entry speed of a block is unchanged even
+        // though the newest block was appended after it. Its exit speed may still
+        // have changed, so the forward pass and trapezoids must start from here.
+        if (!reverse_pass_kernel(current, next) && next) {
+          block_buffer_dirty = block_index;
+          return;
+        }
+      #else
+        reverse_pass_kernel(current, next);
+      #endif
       next = current;
     }
 
@@ -1041,18 +1101,21 @@ void Planner::reverse_pass() {
 // The kernel called by recalculate() when scanning the plan from first to last entry.
 void Planner::forward_pass_kernel(const block_t * const previous, block_t * const current, const uint8_t block_index) {
   if (previous) {
+    const block_plan_t &prev = plan_of(previous);
+    block_plan_t &cur = block_plan[block_index];
+
     // If the previous block is an acceleration block, too short to complete the full speed
     // change, adjust the entry speed accordingly. Entry speeds have already been reset,
     // maximized, and reverse-planned. If nominal length is set, max junction speed is
     // guaranteed to be reached. No need to recheck.
     if (!TEST(previous->flag, BLOCK_BIT_NOMINAL_LENGTH) &&
-      previous->entry_speed_sqr < current->entry_speed_sqr) {
+      prev.entry_speed_sqr < cur.entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+      const float new_entry_speed_sqr = max_allowable_speed_sqr(-prev.acceleration, prev.entry_speed_sqr, prev.millimeters);
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
-      if (new_entry_speed_sqr < current->entry_speed_sqr) {
+      if (new_entry_speed_sqr < cur.entry_speed_sqr) {
 
         // Mark we need to recompute the trapezoidal shape, and do it now,
         // so the stepper ISR does not consume the block before being recalculated
@@ -1071,7 +1134,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
           // Block is not BUSY, we won the race against the Stepper ISR:
 
           // Always <= max_entry_speed_sqr. Backward pass sets this.
-          current->entry_speed_sqr = new_entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
+          cur.entry_speed_sqr = new_entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
 
           // Set optimal plan pointer.
           block_buffer_planned = block_index;
@@ -1083,7 +1146,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
     // point in the buffer. When the plan is bracketed by either the beginning of the
     // buffer and a maximum entry speed or two maximum entry speeds, every block in between
     // cannot logically be further improved. Hence, we don't have to recompute them anymore.
-    if (current->entry_speed_sqr == current->max_entry_speed_sqr)
+    if (cur.entry_speed_sqr == cur.max_entry_speed_sqr)
       block_buffer_planned = block_index;
   }
 }
@@ -1093,6 +1156,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
  * Once in reverse and once forward. This implements the forward pass.
  */
 void Planner::forward_pass() {
+  BENCH_PROBE(FORWARD_PASS);
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
@@ -1103,6 +1167,14 @@ void Planner::forward_pass() {
   //  pass will never modify the values at the tail.
   uint8_t block_index = block_buffer_planned;
 
+  BENCH_COUNT(FORWARD_FULL, BLOCK_MOD(block_buffer_head - block_index));
+
+  #if ENABLED(PLANNER_INCREMENTAL_RECALC)
+    // Blocks ahead of the first one touched by the reverse pass are unchanged
+    if (BLOCK_MOD(block_buffer_head - block_buffer_dirty) < BLOCK_MOD(block_buffer_head - block_index))
+      block_index = block_buffer_dirty;
+  #endif
+
   block_t *block;
   const block_t * previous = nullptr;
   while (block_index != block_buffer_head) {
@@ -1112,6 +1184,7 @@ void Planner::forward_pass() {
 
     // Skip SYNC and page blocks
     if (!(block->flag & BLOCK_MASK_SYNC) && !IS_PAGE(block)) {
+      BENCH_COUNT(FORWARD_KERNELS, 1);
       // If there's no previous block or the previous block is not
       // BUSY (thus, modifiable) run the forward_pass_kernel. Otherwise,
       // the previous block became BUSY, so assume the current block's
@@ -1132,9 +1205,20 @@ void Planner::forward_pass() {
  * recalculate() after updating the blocks.
  */
 void Planner::recalculate_trapezoids() {
+  BENCH_PROBE(RECALCULATE_TRAPEZOIDS);
+
   // The tail may be changed by the ISR so get a local copy.
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+
+  BENCH_COUNT(TRAPEZOIDS_FULL, BLOCK_MOD(head_block_index - block_index));
+
+  #if ENABLED(PLANNER_INCREMENTAL_RECALC)
+    // Trapezoids ahead of the first block touched by the planner passes are unchanged
+    if (BLOCK_MOD(head_block_index - block_buffer_dirty) < BLOCK_MOD(head_block_index - block_index))
+      block_index = block_buffer_dirty;
+  #endif
+
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1162,7 +1246,8 @@ void Planner::recalculate_trapezoids() {
 
     // Skip sync and page blocks
     if (!(next->flag & BLOCK_MASK_SYNC) && !IS_PAGE(next)) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
+      BENCH_COUNT(TRAPEZOIDS, 1);
+      next_entry_speed = SQRT(block_plan[block_index].entry_speed_sqr);
 
       if (block) {
         // Recalculate if current block entry or exit junction speed has changed.
@@ -1180,12 +1265,12 @@ void Planner::recalculate_trapezoids() {
             // Block is not BUSY, we won the race against the Stepper ISR:
 
             // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
+            const float current_nominal_speed = SQRT(plan_of(block).nominal_speed_sqr),
                         nomr = 1.0f / current_nominal_speed;
             calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
+            #if ENABLED(LIN_ADVANCE) && DISABLED(LA_PRESSURE_PROFILE)
               if (block->use_advance_lead) {
-                const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+                const float comp = plan_of(block).e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
                 block->max_adv_steps = current_nominal_speed * comp;
                 block->final_adv_steps = next_entry_speed * comp;
               }
@@ -1219,12 +1304,12 @@ void Planner::recalculate_trapezoids() {
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
-      const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
+      const float next_nominal_speed = SQRT(plan_of(next).nominal_speed_sqr),
                   nomr = 1.0f / next_nominal_speed;
       calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
-      #if ENABLED(LIN_ADVANCE)
+      #if ENABLED(LIN_ADVANCE) && DISABLED(LA_PRESSURE_PROFILE)
         if (next->use_advance_lead) {
-          const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+          const float comp = plan_of(next).e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
           next->max_adv_steps = next_nominal_speed * comp;
           next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
         }
@@ -1238,8 +1323,14 @@ void Planner::recalculate_trapezoids() {
 }
 
 void Planner::recalculate() {
+  BENCH_PROBE(RECALCULATE);
+
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
+
+  // Update all trapezoids unless the reverse pass finds a later starting point
+  TERN_(PLANNER_INCREMENTAL_RECALC, block_buffer_dirty = block_buffer_tail);
+
   // If there is just one block, no planning can be done. Avoid it!
   if (block_index != block_buffer_planned) {
     reverse_pass();
@@ -1452,7 +1543,7 @@ void Planner::check_axes_activity() {
     for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
       block_t *block = &block_buffer[b];
       if (LINEAR_AXIS_GANG(block->steps.x, || block->steps.y, || block->steps.z, || block->steps.i, || block->steps.j, || block->steps.k)) {
-        const float se = (float)block->steps.e / block->step_event_count * SQRT(block->nominal_speed_sqr); // mm/sec;
+        const float se = (float)block->steps.e / block->step_event_count * SQRT(block_plan[b].nominal_speed_sqr); // mm/sec;
         NOLESS(high, se);
       }
     }
@@ -1666,6 +1757,9 @@ void Planner::quick_stop() {
 
   const bool was_enabled = stepper.suspend();
 
+  TERN_(SEGMENT_MERGING, segment_merge.discard());
+  TERN_(CORNER_BLENDING, corner_blend.discard());
+
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
@@ -1673,7 +1767,7 @@ void Planner::quick_stop() {
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 
-  #if HAS_WIRED_LCD
+  #if HAS_BLOCK_RUNTIME
     // Clear the accumulated runtime
     clear_block_buffer_runtime();
   #endif
@@ -1776,7 +1870,10 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
  * Block until all buffered steps are executed / cleaned
  */
 void Planner::synchronize() {
+  TERN_(SEGMENT_MERGING, segment_merge.flush());
+  TERN_(CORNER_BLENDING, corner_blend.flush());
   while (has_blocks_queued() || cleaning_buffer_counter
+      || TERN0(HAS_SHAPING, stepper.shaping_busy())
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
   ) idle();
 }
@@ -1791,6 +1888,7 @@ void Planner::synchronize() {
  *  fr_mm_s       - (target) speed of the move
  *  extruder      - target extruder
  *  millimeters   - the length of the movement, if known
+ *  arc           - the arc to trace, for an arc block
  *
  * Returns true if movement was properly queued, false otherwise (if cleaning)
  */
@@ -1798,6 +1896,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters
+  OPTARG(ARC_BLOCKS, const arc_move_t * const arc)
 ) {
 
   // Wait for the next available block
@@ -1818,6 +1917,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
       , cart_dist_mm
     #endif
     , fr_mm_s, extruder, millimeters
+    OPTARG(ARC_BLOCKS, arc)
   )) {
     // Movement was not queued, probably because it was too short.
     //  Simply accept that as movement queued and done
@@ -1852,6 +1952,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
  *  target      - target position in steps units
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
+ *  arc         - the arc to trace, for an arc block
  *
  * Returns true if movement is acceptable, false otherwise
  */
@@ -1860,7 +1961,10 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters/*=0.0*/
+  OPTARG(ARC_BLOCKS, const arc_move_t * const arc/*=nullptr*/)
 ) {
+  block_plan_t &plan = plan_of(block);
+
   int32_t LOGICAL_AXIS_LIST(
     de = target.e - position.e,
     da = target.a - position.a,
@@ -1979,6 +2083,34 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     if (de < 0) SBI(dm, E_AXIS);
   #endif
 
+  #if ENABLED(ARC_BLOCKS)
+    // Arc geometry in steps, measured from the center
+    xy_float_t arc_r0, arc_r1,  // Radius vectors at the start and end
+               arc_fix,         // Difference between the target and the ideal end of the arc
+               arc_t0, arc_t1;  // Unit tangents at the start and end (mm)
+    float arc_flat_mm;          // Length of the arc in the XY plane
+    if (arc) {
+      const float sx = settings.axis_steps_per_mm[X_AXIS], sy = settings.axis_steps_per_mm[Y_AXIS],
+                  cx = arc->center.x * sx, cy = arc->center.y * sy,
+                  cos_a = cos(arc->angle), sin_a = sin(arc->angle);
+      arc_r0.set(position.a - cx, position.b - cy);
+      arc_r1.set(target.a - cx, target.b - cy);
+      arc_fix.set(
+        arc_r1.x - (arc_r0.x * cos_a - arc_r0.y * sin_a * sx / sy),
+        arc_r1.y - (arc_r0.x * sin_a * sy / sx + arc_r0.y * cos_a)
+      );
+      const float r0 = HYPOT(arc_r0.x / sx, arc_r0.y / sy), r1 = HYPOT(arc_r1.x / sx, arc_r1.y / sy),
+                  f0 = (arc->angle > 0 ? 1 : -1) / r0, f1 = (arc->angle > 0 ? 1 : -1) / r1;
+      arc_t0.set(-arc_r0.y / sy * f0, arc_r0.x / sx * f0);
+      arc_t1.set(-arc_r1.y / sy * f1, arc_r1.x / sx * f1);
+      arc_flat_mm = r0 * ABS(arc->angle);
+
+      // The arc sets out along its tangent, not along the chord
+      if (arc_t0.x < 0) SBI(dm, X_AXIS); else CBI(dm, X_AXIS);
+      if (arc_t0.y < 0) SBI(dm, Y_AXIS); else CBI(dm, Y_AXIS);
+    }
+  #endif
+
   #if HAS_EXTRUDERS
     const float esteps_float = de * e_factor[extruder];
     const uint32_t esteps = ABS(esteps_float) + 0.5f;
@@ -1989,6 +2121,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // Clear all flags, including the "busy" bit
   block->flag = 0x00;
 
+  // No backlash takeup unless a correction adds some
+  TERN_(BACKLASH_STREAM, block->backlash_steps.reset());
+
   // Set direction bits
   block->direction_bits = dm;
 
@@ -2016,6 +2151,16 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->steps.set(LINEAR_AXIS_LIST(ABS(da), ABS(db), ABS(dc), ABS(di), ABS(dj), ABS(dk)));
   #endif
 
+  #if ENABLED(ARC_BLOCKS)
+    if (arc) {
+      // Enough step events that X and Y move at most one step on each
+      block->steps.a = block->steps.b = CEIL(_MAX(
+        arc_flat_mm * settings.axis_steps_per_mm[X_AXIS] + ABS(arc_fix.x),
+        arc_flat_mm * settings.axis_steps_per_mm[Y_AXIS] + ABS(arc_fix.y)
+      )) + 1;
+    }
+  #endif
+
   /**
    * This part of the code calculates the total length of the movement.
    * For cartesian bots, the X_AXIS is the real X movement and same for Y_AXIS.
@@ -2075,6 +2220,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     );
   #endif
 
+  // X and Y may each reach the full arc speed somewhere along the arc
+  TERN_(ARC_BLOCKS, if (arc) steps_dist_mm.a = steps_dist_mm.b = arc_flat_mm);
+
   #if HAS_EXTRUDERS
     steps_dist_mm.e = esteps_float * steps_to_mm[E_AXIS_N(extruder)];
   #endif
@@ -2090,13 +2238,13 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       && block->steps.k < MIN_STEPS_PER_SEGMENT
     )
   ) {
-    block->millimeters = TERN0(HAS_EXTRUDERS, ABS(steps_dist_mm.e));
+    plan.millimeters = TERN0(HAS_EXTRUDERS, ABS(steps_dist_mm.e));
   }
   else {
     if (millimeters)
-      block->millimeters = millimeters;
+      plan.millimeters = millimeters;
     else {
-      block->millimeters = SQRT(
+      plan.millimeters = SQRT(
         #if EITHER(CORE_IS_XY, MARKFORGED_XY)
           LINEAR_AXIS_GANG(
               sq(steps_dist_mm.head.x), + sq(steps_dist_mm.head.y), + sq(steps_dist_mm.z),
@@ -2149,6 +2297,36 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
+  #if ENABLED(ARC_BLOCKS)
+    if (arc) {
+      /**
+       * Set up the circle interpolator. Each step event turns the radius by an equal
+       * angle, and arc.ox / arc.oy shift the circle a little with each event so it
+       * ends on the target, which can be slightly off the circle after rounding.
+       */
+      const float sx = settings.axis_steps_per_mm[X_AXIS], sy = settings.axis_steps_per_mm[Y_AXIS],
+                  a = arc->angle / block->step_event_count,
+                  k = 2 * sq(sin(a * 0.5f)), sxy = sin(a) * sx / sy, syx = sin(a) * sy / sx;
+      int e;
+      frexpf(_MAX(k, ABS(sxy), ABS(syx)), &e);
+      const uint8_t shift = constrain(30 - e, 1, 62);
+      block_arc_t &ba = block->arc;
+      ba.shift = shift;
+      ba.k   = LROUND(ldexpf(k, shift));
+      ba.sxy = LROUND(ldexpf(sxy, shift));
+      ba.syx = LROUND(ldexpf(syx, shift));
+      ba.u = LROUND(ldexpf(arc_r0.x, ARC_FRAC_BITS));
+      ba.v = LROUND(ldexpf(arc_r0.y, ARC_FRAC_BITS));
+      ba.ox = _BV(ARC_FRAC_BITS - 1) - ba.u;
+      ba.oy = _BV(ARC_FRAC_BITS - 1) - ba.v;
+      ba.cx = LROUND(ldexpf(arc_fix.x, ARC_FRAC_BITS) / block->step_event_count);
+      ba.cy = LROUND(ldexpf(arc_fix.y, ARC_FRAC_BITS) / block->step_event_count);
+      ba.dx = da;
+      ba.dy = db;
+      block->flag |= BLOCK_FLAG_IS_ARC;
+    }
+  #endif
+
   TERN_(MIXING_EXTRUDER, mixer.populate_block(block->b_color))
 
   TERN_(HAS_CUTTER, block->cutter_power = cutter.power);
@@ -2250,7 +2428,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   else
     NOLESS(fr_mm_s, settings.min_travel_feedrate_mm_s);
 
-  const float inverse_millimeters = 1.0f / block->millimeters;  // Inverse millimeters to remove multiple divides
+  const float inverse_millimeters = 1.0f / plan.millimeters;  // Inverse millimeters to remove multiple divides
 
   // Calculate inverse time for this move. No divide by zero due to previous checks.
   // Example: At 120mm/s a 60mm move takes 0.5s. So this will give 2.0.
@@ -2260,39 +2438,58 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   const uint8_t moves_queued = nonbusy_movesplanned();
 
   // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
-  #if EITHER(SLOWDOWN, HAS_WIRED_LCD) || defined(XY_FREQUENCY_LIMIT)
+  #if EITHER(SLOWDOWN, HAS_BLOCK_RUNTIME) || defined(XY_FREQUENCY_LIMIT)
     // Segment time im micro seconds
     int32_t segment_time_us = LROUND(1000000.0f / inverse_secs);
   #endif
 
+  #if ENABLED(PLANNER_BUFFER_TIME)
+    const uint32_t buffered_us = block_buffer_runtime_us;
+    NOMORE(buffer_time_low_us, buffered_us);
+  #endif
+
   #if ENABLED(SLOWDOWN)
-    #ifndef SLOWDOWN_DIVISOR
-      #define SLOWDOWN_DIVISOR 2
-    #endif
-    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1)) {
-      const int32_t time_diff = settings.min_segment_time_us - segment_time_us;
-      if (time_diff > 0) {
-        // Buffer is draining so add extra time. The amount of time added increases if the buffer is still emptied more.
-        const int32_t nst = segment_time_us + LROUND(2 * time_diff / moves_queued);
-        inverse_secs = 1000000.0f / nst;
-        #if defined(XY_FREQUENCY_LIMIT) || HAS_WIRED_LCD
+    #if ENABLED(PLANNER_BUFFER_TIME)
+      // Slow down when less than the minimum time is queued, more as the buffer drains
+      const int32_t min_buffered_us = int32_t(buffer_time_min_ms) * 1000L;
+      if (moves_queued >= 2 && int32_t(buffered_us) < min_buffered_us) {
+        const int32_t time_diff = settings.min_segment_time_us - segment_time_us;
+        if (time_diff > 0) {
+          const int32_t nst = segment_time_us + LROUND(float(time_diff) * (min_buffered_us - int32_t(buffered_us)) / min_buffered_us);
+          buffer_slowdowns++;
+          inverse_secs = 1000000.0f / nst;
           segment_time_us = nst;
-        #endif
+        }
       }
-    }
+    #else
+      #ifndef SLOWDOWN_DIVISOR
+        #define SLOWDOWN_DIVISOR 2
+      #endif
+      if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1)) {
+        const int32_t time_diff = settings.min_segment_time_us - segment_time_us;
+        if (time_diff > 0) {
+          // Buffer is draining so add extra time. The amount of time added increases if the buffer is still emptied more.
+          const int32_t nst = segment_time_us + LROUND(2 * time_diff / moves_queued);
+          inverse_secs = 1000000.0f / nst;
+          #if defined(XY_FREQUENCY_LIMIT) || HAS_BLOCK_RUNTIME
+            segment_time_us = nst;
+          #endif
+        }
+      }
+    #endif
   #endif
 
-  #if HAS_WIRED_LCD
+  #if HAS_BLOCK_RUNTIME
     // Protect the access to the position.
     const bool was_enabled = stepper.suspend();
 
     block_buffer_runtime_us += segment_time_us;
-    block->segment_time_us = segment_time_us;
+    plan.segment_time_us = segment_time_us;
 
     if (was_enabled) stepper.wake_up();
   #endif
 
-  block->nominal_speed_sqr = sq(block->millimeters * inverse_secs);   // (mm/sec)^2 Always > 0
+  plan.nominal_speed_sqr = sq(plan.millimeters * inverse_secs);   // (mm/sec)^2 Always > 0
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -2384,11 +2581,21 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   #endif // XY_FREQUENCY_LIMIT
 
+  #if ENABLED(ARC_BLOCKS)
+    if (arc) {
+      // Keep the centripetal acceleration (v^2 / r) within the X and Y limits
+      const float r_mm = arc_flat_mm / ABS(arc->angle),
+                  max_xy_speed_sqr = r_mm * _MIN(settings.max_acceleration_mm_per_s2[X_AXIS], settings.max_acceleration_mm_per_s2[Y_AXIS]),
+                  xy_speed_sqr = plan.nominal_speed_sqr * sq(arc_flat_mm / plan.millimeters);
+      if (xy_speed_sqr > max_xy_speed_sqr) NOMORE(speed_factor, SQRT(max_xy_speed_sqr / xy_speed_sqr));
+    }
+  #endif
+
   // Correct the speed
   if (speed_factor < 1.0f) {
     current_speed *= speed_factor;
     block->nominal_rate *= speed_factor;
-    block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
+    plan.nominal_speed_sqr = plan.nominal_speed_sqr * sq(speed_factor);
   }
 
   // Compute and limit the acceleration rate for the trapezoid generator.
@@ -2437,22 +2644,23 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
                               && de > 0;
 
       if (block->use_advance_lead) {
-        block->e_D_ratio = (target_float.e - position_float.e) /
+        plan.e_D_ratio = (target_float.e - position_float.e) /
           #if IS_KINEMATIC
-            block->millimeters
+            plan.millimeters
           #else
+            (TERN0(ARC_BLOCKS, arc) ? plan.millimeters :
             SQRT(sq(target_float.x - position_float.x)
                + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+               + sq(target_float.z - position_float.z)))
           #endif
         ;
 
         // Check for unusual high e_D ratio to detect if a retract move was combined with the last print move due to min. steps per segment. Never execute this with advance!
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
-        if (block->e_D_ratio > 3.0f)
+        if (plan.e_D_ratio > 3.0f)
           block->use_advance_lead = false;
         else {
-          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (extruder_advance_K[active_extruder] * block->e_D_ratio) * steps_per_mm;
+          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (extruder_advance_K[active_extruder] * plan.e_D_ratio) * steps_per_mm;
           if (TERN0(LA_DEBUG, accel > max_accel_steps_per_s2))
             SERIAL_ECHOLNPGM("Acceleration limited.");
           NOMORE(accel, max_accel_steps_per_s2);
@@ -2484,16 +2692,19 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       );
     }
   }
-  block->acceleration_steps_per_s2 = accel;
-  block->acceleration = accel / steps_per_mm;
+  plan.acceleration_steps_per_s2 = accel;
+  plan.acceleration = accel / steps_per_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (sq(4096.0f) / (STEPPER_TIMER_RATE)));
   #endif
-  #if ENABLED(LIN_ADVANCE)
+  #if ENABLED(LA_PRESSURE_PROFILE)
+    if (block->use_advance_lead)
+      block->advance_rate = extruder_advance_K[active_extruder] * float(block->steps.e) / float(block->step_event_count) * 16777216.0f;
+  #elif ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
-      block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
+      block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * plan.e_D_ratio * plan.acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
       #if ENABLED(LA_DEBUG)
-        if (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * 2 < SQRT(block->nominal_speed_sqr) * block->e_D_ratio)
+        if (extruder_advance_K[active_extruder] * plan.e_D_ratio * plan.acceleration * 2 < SQRT(plan.nominal_speed_sqr) * plan.e_D_ratio)
           SERIAL_ECHOLNPGM("More than 2 steps per eISR loop executed.");
         if (block->advance_speed < 200)
           SERIAL_ECHOLNPGM("eISR running at > 10kHz.");
@@ -2549,6 +2760,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       #endif
     ;
 
+    #if ENABLED(ARC_BLOCKS)
+      // An arc joins the previous block along the tangent at its start
+      if (arc) {
+        unit_vec.x = arc_t0.x * arc_flat_mm;
+        unit_vec.y = arc_t0.y * arc_flat_mm;
+      }
+    #endif
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
@@ -2586,7 +2805,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
         normalize_junction_vector(junction_unit_vec);
 
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
+        const float junction_acceleration = limit_value_by_axis_maximum(plan.acceleration, junction_unit_vec),
                     sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
 
         vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
@@ -2594,7 +2813,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
 
           // For small moves with >135° junction (octagon) find speed for approximate arc
-          if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
+          if (plan.millimeters < 1 && junction_cos_theta < -0.7071067812f) {
 
             #if ENABLED(JD_USE_MATH_ACOS)
 
@@ -2673,7 +2892,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
             #endif
 
-            const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
+            const float limit_sqr = (plan.millimeters * junction_acceleration) / junction_theta;
             NOMORE(vmax_junction_sqr, limit_sqr);
           }
 
@@ -2681,13 +2900,22 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       }
 
       // Get the lowest speed
-      vmax_junction_sqr = _MIN(vmax_junction_sqr, block->nominal_speed_sqr, previous_nominal_speed_sqr);
+      vmax_junction_sqr = _MIN(vmax_junction_sqr, plan.nominal_speed_sqr, previous_nominal_speed_sqr);
     }
     else // Init entry speed to zero. Assume it starts from rest. Planner will correct this later.
       vmax_junction_sqr = 0;
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(ARC_BLOCKS)
+      // The next block joins the arc along the tangent at its end
+      if (arc) {
+        const float xy = HYPOT(unit_vec.x, unit_vec.y);
+        prev_unit_vec.x = arc_t1.x * xy;
+        prev_unit_vec.y = arc_t1.y * xy;
+      }
+    #endif
+
   #endif
 
   #ifdef USE_CACHED_SQRT
@@ -2704,7 +2932,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
      * Adapted from Průša MKS firmware
      * https://github.com/prusa3d/Prusa-Firmware
      */
-    CACHED_SQRT(nominal_speed, block->nominal_speed_sqr);
+    CACHED_SQRT(nominal_speed, plan.nominal_speed_sqr);
 
     // Exit speed limited by a jerk to full halt of a previous last segment
     static float previous_safe_speed;
@@ -2800,14 +3028,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   #endif // Classic Jerk Limiting
 
   // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed_sqr = vmax_junction_sqr;
+  plan.max_entry_speed_sqr = vmax_junction_sqr;
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+  const float v_allowable_sqr = max_allowable_speed_sqr(-plan.acceleration, sq(float(MINIMUM_PLANNER_SPEED)), plan.millimeters);
 
   // If we are trying to add a split block, start with the
   // max. allowed speed to avoid an interrupted first move.
-  block->entry_speed_sqr = !split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : _MIN(vmax_junction_sqr, v_allowable_sqr);
+  plan.entry_speed_sqr = !split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : _MIN(vmax_junction_sqr, v_allowable_sqr);
 
   // Initialize planner efficiency flags
   // Set flag if block will always reach maximum junction speed regardless of entry/exit speeds.
@@ -2817,11 +3045,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // block nominal speed limits both the current and next maximum junction speeds. Hence, in both
   // the reverse and forward planners, the corresponding block junction speed will always be at the
   // the maximum junction speed and may always be ignored for any speed reduction checks.
-  block->flag |= block->nominal_speed_sqr <= v_allowable_sqr ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
+  block->flag |= plan.nominal_speed_sqr <= v_allowable_sqr ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
-  previous_nominal_speed_sqr = block->nominal_speed_sqr;
+  previous_nominal_speed_sqr = plan.nominal_speed_sqr;
 
   position = target;  // Update the position
 
@@ -2843,6 +3071,9 @@ void Planner::buffer_sync_block(TERN_(LASER_SYNCHRONOUS_M106_M107, uint8_t sync_
     constexpr uint8_t sync_flag = BLOCK_FLAG_SYNC_POSITION;
   #endif
 
+  TERN_(SEGMENT_MERGING, segment_merge.flush());
+  TERN_(CORNER_BLENDING, corner_blend.flush());
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -2884,17 +3115,23 @@ void Planner::buffer_sync_block(TERN_(LASER_SYNCHRONOUS_M106_M107, uint8_t sync_
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
  *  millimeters - the length of the movement, if known
+ *  arc         - the arc to trace, for an arc block
  *
  * Return 'false' if no segment was queued due to cleaning, cold extrusion, full queue, etc.
  */
 bool Planner::buffer_segment(const abce_pos_t &abce
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const_float_t millimeters/*=0.0*/
+  OPTARG(ARC_BLOCKS, const arc_move_t * const arc/*=nullptr*/)
 ) {
 
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  // Moves queued directly (not by merging or blending) start a new path
+  TERN_(SEGMENT_MERGING, segment_merge.reset());
+  TERN_(CORNER_BLENDING, corner_blend.reset());
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && settings.axis_steps_per_mm[E_AXIS_N(extruder)] != settings.axis_steps_per_mm[E_AXIS_N(last_extruder)]) {
@@ -2981,7 +3218,8 @@ bool Planner::buffer_segment(const abce_pos_t &abce
       #if HAS_DIST_MM_ARG
         , cart_dist_mm
       #endif
-      , fr_mm_s, extruder, millimeters)
+      , fr_mm_s, extruder, millimeters
+      OPTARG(ARC_BLOCKS, arc))
   ) return false;
 
   stepper.wake_up();
@@ -2998,10 +3236,26 @@ bool Planner::buffer_segment(const abce_pos_t &abce
  *  extruder        - target extruder
  *  millimeters     - the length of the movement, if known
  *  inv_duration    - the reciprocal if the duration of the movement, if known (kinematic only if feeedrate scaling is enabled)
+ *  joints          - the kinematic joint positions of 'cart', if already known (INCREMENTAL_IK)
  */
 bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const float millimeters/*=0.0*/
   OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration/*=0.0*/)
+  OPTARG(INCREMENTAL_IK, const abce_pos_t * const joints/*=nullptr*/)
 ) {
+  #if EITHER(SEGMENT_MERGING, CORNER_BLENDING)
+    // A given length belongs to this exact move, so only reshape moves without one.
+    // Moves with a length go to buffer_segment(), which flushes the held moves first.
+    if (!millimeters) return TERN(SEGMENT_MERGING, segment_merge, corner_blend).add(cart, fr_mm_s, extruder);
+  #endif
+  return _buffer_line(cart, fr_mm_s, extruder, millimeters OPTARG(SCARA_FEEDRATE_SCALING, inv_duration) OPTARG(INCREMENTAL_IK, joints));
+}
+
+bool Planner::_buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const float millimeters/*=0.0*/
+  OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration/*=0.0*/)
+  OPTARG(INCREMENTAL_IK, const abce_pos_t * const joints/*=nullptr*/)
+) {
+  BENCH_PROBE(BUFFER_LINE);
+
   xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
@@ -3023,7 +3277,10 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
     const float mm = millimeters ?: (cart_dist_mm.x || cart_dist_mm.y) ? cart_dist_mm.magnitude() : TERN0(HAS_Z_AXIS, ABS(cart_dist_mm.z));
 
     // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
+    #if ENABLED(INCREMENTAL_IK)
+      if (joints) delta = *joints; else
+    #endif
+        inverse_kinematics(machine);
 
     #if ENABLED(SCARA_FEEDRATE_SCALING)
       // For SCARA scale the feed rate from mm/s to degrees/s
@@ -3045,9 +3302,25 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
   #endif
 } // buffer_line()
 
+#if ENABLED(ARC_BLOCKS)
+
+  bool Planner::buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const_float_t angle,
+    const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters
+  ) {
+    xyze_pos_t machine = cart;
+    TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+
+    const arc_move_t arc = { center, angle };
+    return buffer_segment(machine, fr_mm_s, extruder, millimeters, &arc);
+  }
+
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
+    TERN_(SEGMENT_MERGING, segment_merge.reset());
+    TERN_(CORNER_BLENDING, corner_blend.reset());
     if (!last_page_step_rate) {
       kill(GET_TEXT(MSG_BAD_PAGE_SPEED));
       return;
@@ -3111,6 +3384,8 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
  * The provided ABCE position is in machine units.
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
+  TERN_(SEGMENT_MERGING, segment_merge.reset());
+  TERN_(CORNER_BLENDING, corner_blend.reset());
   TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
   TERN_(HAS_POSITION_FLOAT, position_float = abce);
   position.set(
@@ -3152,6 +3427,8 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
    * Setters for planner position (also setting stepper position).
    */
   void Planner::set_e_position_mm(const_float_t e) {
+    TERN_(SEGMENT_MERGING, segment_merge.set_e(e));
+    TERN_(CORNER_BLENDING, corner_blend.set_e(e));
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
@@ -3272,7 +3549,7 @@ void Planner::set_max_feedrate(const uint8_t axis, float inMaxFeedrateMMS) {
 
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
 
   uint16_t Planner::block_buffer_runtime() {
     #ifdef __AVR__
@@ -73,6 +73,12 @@
   #define IS_PAGE(B) false
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+  #define IS_ARC(B) TEST(B->flag, BLOCK_BIT_IS_ARC)
+#else
+  #define IS_ARC(B) false
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   constexpr xyze_feedrate_t _mf = MANUAL_FEEDRATE,
@@ -109,9 +115,19 @@ enum BlockFlagBit : char {
   #if ENABLED(LASER_SYNCHRONOUS_M106_M107)
     , BLOCK_BIT_SYNC_FANS
   #endif
+
+  // Step timing prepared by the main loop (See Stepper::prepare_step_timing)
+  #if ENABLED(STEP_TIMING_TABLE)
+    , BLOCK_BIT_STEP_TIMING
+  #endif
+
+  // XY arc traced by the Stepper circle interpolator
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_BIT_IS_ARC
+  #endif
 };
 
-enum BlockFlag : char {
+enum BlockFlag : uint8_t {
     BLOCK_FLAG_RECALCULATE          = _BV(BLOCK_BIT_RECALCULATE)
   , BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH)
   , BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED)
@@ -122,6 +138,12 @@ enum BlockFlag : char {
   #if ENABLED(LASER_SYNCHRONOUS_M106_M107)
     , BLOCK_FLAG_SYNC_FANS          = _BV(BLOCK_BIT_SYNC_FANS)
   #endif
+  #if ENABLED(STEP_TIMING_TABLE)
+    , BLOCK_FLAG_STEP_TIMING        = _BV(BLOCK_BIT_STEP_TIMING)
+  #endif
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_FLAG_IS_ARC             = _BV(BLOCK_BIT_IS_ARC)
+  #endif
 };
 
 #define BLOCK_MASK_SYNC ( BLOCK_FLAG_SYNC_POSITION | TERN0(LASER_SYNCHRONOUS_M106_M107, BLOCK_FLAG_SYNC_FANS) )
@@ -150,6 +172,39 @@ enum BlockFlag : char {
 
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+
+  #define ARC_FRAC_BITS 14                  // Fraction bits of the circle interpolator position
+  #define ARC_MAX_RADIUS_STEPS _BV(16)      // Keeps the fixed-point position under 2^30
+
+  /**
+   * A native arc, as given to Planner::buffer_arc
+   */
+  typedef struct {
+    xy_pos_t center;                        // Center of the arc (mm)
+    float angle;                            // Angular travel (radians). Positive is counter-clockwise.
+  } arc_move_t;
+
+  /**
+   * Circle interpolator setup for an arc block.
+   * Each step event rotates the position (u,v) by a fixed angle:
+   *   u -= (k * u + sxy * v) >> shift
+   *   v += (syx * u - k * v) >> shift
+   * where k = 1 - cos(a) and sxy / syx are sin(a) scaled by the X/Y steps-per-mm ratio.
+   * The X/Y position in whole steps from the start is then (u + ox) >> ARC_FRAC_BITS,
+   * with ox growing by cx on each event to bring the circle onto the target.
+   */
+  typedef struct {
+    int32_t u, v,                           // Start position relative to the center (steps << ARC_FRAC_BITS)
+            ox, oy,                         // Offsets that round (u,v) to whole steps from the start
+            cx, cy;                         // Offset change per step event
+    int32_t k, sxy, syx;                    // Rotation coefficients (<< shift)
+    int32_t dx, dy;                         // Whole steps from the start to the end of the arc
+    uint8_t shift;                          // Fixed-point shift of the rotation coefficients
+  } block_arc_t;
+
+#endif
+
 /**
  * struct block_t
  *
@@ -158,23 +213,16 @@ enum BlockFlag : char {
  *
  * The "nominal" values are as-specified by gcode, and
  * may never actually be reached due to acceleration limits.
+ *
+ * Only the fields needed to execute the block are kept here, with those
+ * read on every Stepper ISR first. Look-ahead data used only by the
+ * planner lives in a parallel block_plan_t (See Planner::plan_of).
  */
 typedef struct block_t {
 
   volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
-
-  union {
-    abce_ulong_t steps;                     // Step count along each axis
-    abce_long_t position;                   // New position to force when this sync block is executed
-  };
-  uint32_t step_event_count;                // The number of step events required to complete this block
+  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
@@ -182,46 +230,67 @@ typedef struct block_t {
     static constexpr uint8_t extruder = 0;
   #endif
 
-  #if ENABLED(MIXING_EXTRUDER)
-    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;
+  #endif
+
+  union {
+    abce_ulong_t steps;                     // Step count along each axis
+    abce_long_t position;                   // New position to force when this sync block is executed
+  };
+  uint32_t step_event_count;                // The number of step events required to complete this block
+
+  #if ENABLED(BACKLASH_STREAM)
+    xyz_ulong_t backlash_steps;             // Takeup steps issued apart from the block's own steps
   #endif
 
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
            decelerate_after;                // The index of the step event on which to start decelerating
 
+  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
+           initial_rate,                    // The jerk-adjusted step rate at start of block
+           final_rate;                      // The minimal rate at exit
+
   #if ENABLED(S_CURVE_ACCELERATION)
     uint32_t cruise_rate,                   // The actual cruise rate to use, between end of the acceleration phase and start of deceleration phase
              acceleration_time,             // Acceleration time and deceleration time in STEP timer counts
-             deceleration_time,
-             acceleration_time_inverse,     // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
-             deceleration_time_inverse;
+             deceleration_time;
+    #ifdef __AVR__
+      uint32_t acceleration_time_inverse,   // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
+               deceleration_time_inverse;   // (32-bit CPUs divide quickly enough to get these in the Stepper ISR)
+    #endif
   #else
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-
   // Advance extrusion
-  #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
+  #if ENABLED(LA_PRESSURE_PROFILE)
+    uint32_t advance_rate;                  // Advance steps per step event/s (Q24). The advance follows the step rate.
+  #elif ENABLED(LIN_ADVANCE)
     uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
              max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
              final_adv_steps;               // advance steps due to exit speed
-    float e_D_ratio;
   #endif
 
-  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
-           initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+  #if ENABLED(LASER_POWER_INLINE)
+    block_laser_t laser;
+  #endif
+
+  #if HAS_CUTTER
+    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #endif
 
   #if ENABLED(DIRECT_STEPPING)
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
-  #if HAS_CUTTER
-    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #if ENABLED(ARC_BLOCKS)
+    block_arc_t arc;                        // Circle interpolator setup for an arc block
+  #endif
+
+  #if ENABLED(MIXING_EXTRUDER)
+    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
   #endif
 
   #if HAS_FAN
@@ -232,19 +301,38 @@ typedef struct block_t {
     uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
-  #if HAS_WIRED_LCD
-    uint32_t segment_time_us;
-  #endif
-
   #if ENABLED(POWER_LOSS_RECOVERY)
     uint32_t sdpos;
   #endif
 
-  #if ENABLED(LASER_POWER_INLINE)
-    block_laser_t laser;
+} block_t;
+
+/**
+ * struct block_plan_t
+ *
+ * Look-ahead data for a block_t, used to plan its speeds
+ * and trapezoid but never read by the Stepper ISR.
+ */
+typedef struct {
+
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
+
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
+
+  #if ENABLED(LIN_ADVANCE)
+    float e_D_ratio;
   #endif
 
-} block_t;
+  #if HAS_BLOCK_RUNTIME
+    uint32_t segment_time_us;
+  #endif
+
+} block_plan_t;
 
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL)
   #define HAS_POSITION_FLOAT 1
@@ -331,6 +419,7 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
+    static block_plan_t block_plan[BLOCK_BUFFER_SIZE];   // Look-ahead data for each block_buffer entry
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
                             block_buffer_nonbusy,   // Index of the first non busy block
                             block_buffer_planned,   // Index of the optimally planned block
@@ -439,6 +528,18 @@ class Planner {
       }
     #endif
 
+    #if ENABLED(PLANNER_BUFFER_TIME)
+      static uint16_t buffer_time_min_ms,     // Slow down with less motion queued
+                      buffer_time_max_ms;     // Queue no more motion than this (0 = no limit)
+      static uint32_t buffer_time_low_us,     // Least motion queued ahead of a new move since the last reset
+                      buffer_slowdowns;       // Moves slowed down for a low buffer since the last reset
+      static inline void reset_buffer_stats() { buffer_time_low_us = UINT32_MAX; buffer_slowdowns = 0; }
+      FORCE_INLINE static uint32_t buffered_time_us() { return block_buffer_runtime_us; }
+      FORCE_INLINE static bool buffer_time_full() {
+        return buffer_time_max_ms && block_buffer_runtime_us >= buffer_time_max_ms * 1000UL;
+      }
+    #endif
+
   private:
 
     /**
@@ -456,6 +557,11 @@ class Planner {
      */
     static uint32_t acceleration_long_cutoff;
 
+    #if ENABLED(PLANNER_INCREMENTAL_RECALC)
+      // Index of the first block whose exit speed may have changed in recalculate()
+      static uint8_t block_buffer_dirty;
+    #endif
+
     #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
       static float last_fade_z;
     #endif
@@ -465,7 +571,7 @@ class Planner {
       static last_move_t g_uc_extruder_last_move[E_STEPPERS];
     #endif
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
@@ -686,8 +792,13 @@ class Planner {
     // Remove all blocks from the buffer
     FORCE_INLINE static void clear_block_buffer() { block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail = 0; }
 
-    // Check if movement queue is full
-    FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
+    // Get the look-ahead data for a block in the buffer
+    FORCE_INLINE static block_plan_t& plan_of(const block_t * const block) { return block_plan[block - block_buffer]; }
+
+    // Check if movement queue is full, by block count or by queued time
+    FORCE_INLINE static bool is_full() {
+      return block_buffer_tail == next_block_index(block_buffer_head) || TERN0(PLANNER_BUFFER_TIME, buffer_time_full());
+    }
 
     // Get count of movement slots free
     FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
@@ -701,8 +812,8 @@ class Planner {
      */
     FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
 
-      // Wait until there are enough slots free
-      while (moves_free() < count) { idle(); }
+      // Wait until there are enough slots free, and time to fill
+      while (moves_free() < count || TERN0(PLANNER_BUFFER_TIME, buffer_time_full())) { idle(); }
 
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
@@ -718,6 +829,7 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the arc to trace, for an arc block
      *
      * Returns true if movement was buffered, false otherwise
      */
@@ -725,6 +837,7 @@ class Planner {
       OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(ARC_BLOCKS, const arc_move_t * const arc=nullptr)
     );
 
     /**
@@ -736,6 +849,7 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the arc to trace, for an arc block
      *
      * Returns true is movement is acceptable, false otherwise
      */
@@ -743,6 +857,7 @@ class Planner {
       OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(ARC_BLOCKS, const arc_move_t * const arc=nullptr)
     );
 
     /**
@@ -772,10 +887,12 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the arc to trace, for an arc block
      */
     static bool buffer_segment(const abce_pos_t &abce
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , const_feedRate_t fr_mm_s, const uint8_t extruder=active_extruder, const_float_t millimeters=0.0
+      OPTARG(ARC_BLOCKS, const arc_move_t * const arc=nullptr)
     );
 
   public:
@@ -790,11 +907,36 @@ class Planner {
      *  extruder     - target extruder
      *  millimeters  - the length of the movement, if known
      *  inv_duration - the reciprocal if the duration of the movement, if known (kinematic only if feeedrate scaling is enabled)
+     *  joints       - the kinematic joint positions of 'cart', if already known (INCREMENTAL_IK)
      */
     static bool buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder=active_extruder, const float millimeters=0.0
       OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration=0.0)
+      OPTARG(INCREMENTAL_IK, const abce_pos_t * const joints=nullptr)
     );
 
+    #if ENABLED(ARC_BLOCKS)
+      /**
+       * Add an XY arc to the buffer as a single block.
+       * The Stepper traces the arc with its circle interpolator.
+       *
+       *  cart        - target position in mm
+       *  center      - center of the arc in mm
+       *  angle       - angular travel in radians. Positive is counter-clockwise.
+       *  fr_mm_s     - (target) speed of the move (mm/s)
+       *  extruder    - target extruder
+       *  millimeters - the (helical) length of the arc
+       */
+      static bool buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const_float_t angle,
+        const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters
+      );
+
+      // Can an arc with the given radius (mm) be traced by the Stepper?
+      static bool arc_block_fits(const_float_t radius) {
+        const float r = radius * _MAX(settings.axis_steps_per_mm[X_AXIS], settings.axis_steps_per_mm[Y_AXIS]);
+        return r >= 1 && r < ARC_MAX_RADIUS_STEPS;
+      }
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -897,7 +1039,7 @@ class Planner {
         block_buffer_tail = next_block_index(block_buffer_tail);
     }
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       static uint16_t block_buffer_runtime();
       static void clear_block_buffer_runtime();
     #endif
@@ -921,6 +1063,23 @@ class Planner {
 
   private:
 
+    #if ENABLED(PLANNER_BENCHMARK)
+      friend class PlannerBench;
+    #endif
+
+    #if ENABLED(SEGMENT_MERGING)
+      friend class SegmentMerge;
+    #endif
+    #if ENABLED(CORNER_BLENDING)
+      friend class CornerBlend;
+    #endif
+
+    // Add a linear move, bypassing segment merging and corner blending. See buffer_line().
+    static bool _buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder=active_extruder, const float millimeters=0.0
+      OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration=0.0)
+      OPTARG(INCREMENTAL_IK, const abce_pos_t * const joints=nullptr)
+    );
+
     #if ENABLED(AUTOTEMP)
       #if ENABLED(AUTOTEMP_PROPORTIONAL)
         static void _autotemp_update_from_hotend();
@@ -975,9 +1134,62 @@ class Planner {
       }
     #endif
 
+    #if ENABLED(FIXED_POINT_TRAPEZOID)
+      /**
+       * Integer-only versions of the above for CPUs without an FPU.
+       * With rates in steps/s and accel in steps/s^2 every term is exact
+       * in 64 bits, so rounding only happens in the final division.
+       */
+      static int64_t div_floor(const int64_t n, const int64_t d) {
+        const int64_t q = n / d;
+        return (n % d && ((n < 0) != (d < 0))) ? q - 1 : q;
+      }
+      static int64_t div_ceil(const int64_t n, const int64_t d) {
+        const int64_t q = n / d;
+        return (n % d && ((n < 0) == (d < 0))) ? q + 1 : q;
+      }
+      static int64_t rate_sq(const uint32_t rate) { return int64_t(uint64_t(rate) * rate); }
+
+      // Steps to accelerate from initial_rate to target_rate, rounded up or down
+      static int32_t estimate_acceleration_steps(const uint32_t initial_rate, const uint32_t target_rate, const int32_t accel, const bool round_up) {
+        if (accel == 0) return 0;
+        const int64_t n = rate_sq(target_rate) - rate_sq(initial_rate), d = int64_t(accel) * 2;
+        return round_up ? div_ceil(n, d) : div_floor(n, d);
+      }
+
+      // Step at which to start braking to reach final_rate at the end, rounded up
+      static int32_t intersection_steps(const uint32_t initial_rate, const uint32_t final_rate, const int32_t accel, const uint32_t distance) {
+        if (accel == 0) return 0;
+        return div_ceil(int64_t(accel) * 2 * distance - rate_sq(initial_rate) + rate_sq(final_rate), int64_t(accel) * 4);
+      }
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // Bitwise square root, rounded down
+        static uint32_t isqrt(uint64_t n) {
+          uint64_t r = 0, bit = 1ULL << 62;
+          while (bit > n) bit >>= 2;
+          for (; bit; bit >>= 2) {
+            if (n >= r + bit) { n -= r + bit; r = (r >> 1) + bit; }
+            else r >>= 1;
+          }
+          return uint32_t(r);
+        }
+
+        // Rate reached from initial_rate after accelerating over distance steps
+        static uint32_t final_rate_after(const uint32_t initial_rate, const int32_t accel, const uint32_t distance) {
+          return isqrt(uint64_t(rate_sq(initial_rate) + int64_t(accel) * 2 * distance));
+        }
+
+        // Time to change between two rates, in stepper timer ticks
+        static uint32_t rate_change_ticks(const uint32_t rate_diff, const int32_t accel) {
+          return uint32_t(uint64_t(rate_diff) * (STEPPER_TIMER_RATE) / uint32_t(accel));
+        }
+      #endif
+    #endif
+
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
 
-    static void reverse_pass_kernel(block_t * const current, const block_t * const next);
+    static bool reverse_pass_kernel(block_t * const current, const block_t * const next);
     static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
 
     static void reverse_pass();
@@ -60,6 +60,246 @@ static inline float eval_bezier(const_float_t a, const_float_t b, const_float_t
   return interp(iabc, ibcd, t);
 }
 
+#ifdef BEZIER_CURVE_TOLERANCE
+
+/**
+ * The curve in the XY plane, as its four control points. Z and E follow
+ * the XY distance along the curve.
+ */
+typedef xy_pos_t bezier_t[4];
+
+// The point at t
+static xy_pos_t bez_point(const bezier_t &c, const_float_t t) {
+  const float s = 1 - t;
+  return c[0] * (s * s * s) + c[1] * (3 * s * s * t) + c[2] * (3 * s * t * t) + c[3] * (t * t * t);
+}
+
+// The first derivative (velocity) at t
+static xy_pos_t bez_d1(const bezier_t &c, const_float_t t) {
+  const float s = 1 - t;
+  return (c[1] - c[0]) * (3 * s * s) + (c[2] - c[1]) * (6 * s * t) + (c[3] - c[2]) * (3 * t * t);
+}
+
+// The second derivative at t. Linear in t, so over any interval its magnitude peaks at an end.
+static xy_pos_t bez_d2(const bezier_t &c, const_float_t t) {
+  return (c[2] - c[1] * 2 + c[0]) * (6 * (1 - t)) + (c[3] - c[2] * 2 + c[1]) * (6 * t);
+}
+
+// XY length of the curve by 5-point Gauss-Legendre quadrature over quarters of the curve
+static float bez_length(const bezier_t &c) {
+  static const float gx[] = { 0, 0.5384693101f, 0.9061798459f },
+                     gw[] = { 0.5688888889f, 0.4786286705f, 0.2369268851f };
+  float len = 0;
+  LOOP_L_N(q, 4) {
+    const float mid = 0.25f * q + 0.125f;
+    len += gw[0] * bez_d1(c, mid).magnitude();
+    LOOP_S_L_N(i, 1, 3) {
+      const float dt = 0.125f * gx[i];
+      len += gw[i] * (bez_d1(c, mid - dt).magnitude() + bez_d1(c, mid + dt).magnitude());
+    }
+  }
+  return 0.125f * len;
+}
+
+// Limit the speed so the centripetal acceleration at t stays within 'accel'
+static void bez_limit_speed(float &fr_mm_s, const bezier_t &c, const_float_t t, const_float_t accel) {
+  const xy_pos_t d1 = bez_d1(c, t), d2 = bez_d2(c, t);
+  const float cross = ABS(d1.x * d2.y - d1.y * d2.x), m = d1.magnitude();
+  if (cross) NOMORE(fr_mm_s, SQRT(accel * m * m * m / cross)); // v^2 = a / k, k = |D1 x D2| / |D1|^3
+}
+
+enum SpanType : uint8_t { SPAN_NONE, SPAN_LINE, SPAN_ARC };
+
+/**
+ * Try to cover the span from t0 to t1 with a single block. A nearly straight
+ * span becomes a line if the curve at the quarter points and the middle is
+ * within tolerance of it. Otherwise, with ARC_BLOCKS, try the arc through the
+ * ends and the middle of the span, checking the curve at the quarter points.
+ */
+static SpanType bez_fit_span(const bezier_t &c, const xy_pos_t &p0, const_float_t t0, const_float_t t1, const bool arcs, xy_pos_t &center, float &angle) {
+  constexpr float tol = BEZIER_CURVE_TOLERANCE;
+  const float h = t1 - t0;
+  const xy_pos_t u = bez_point(c, t0 + 0.5f * h) - p0, w = bez_point(c, t1) - p0;
+  const float cross = u.x * w.y - u.y * w.x, ww = sq(w.x) + sq(w.y);
+  if (!ww) return SPAN_NONE;                          // Closed loop
+
+  // Is the middle within tolerance of the chord?
+  if (sq(cross) <= sq(tol) * ww) {
+    LOOP_L_N(q, 2) {
+      const xy_pos_t v = bez_point(c, t0 + (q ? 0.75f : 0.25f) * h) - p0;
+      const float along = v.x * w.x + v.y * w.y;
+      if (along < 0 || along > ww || sq(v.x * w.y - v.y * w.x) > sq(tol) * ww) return SPAN_NONE;
+    }
+    return SPAN_LINE;
+  }
+
+  #if ENABLED(ARC_BLOCKS)
+    if (arcs) {
+      const float d = 2 * cross, uu = sq(u.x) + sq(u.y);
+      const xy_pos_t to_center = { (w.y * uu - u.y * ww) / d, (u.x * ww - w.x * uu) / d };
+      const float radius = to_center.magnitude();
+      if (!planner.arc_block_fits(radius)) return SPAN_NONE;
+
+      // Sweep from p0 to p1 in the direction of the middle point
+      const xy_pos_t r0 = -to_center, r1 = w - to_center;
+      angle = ATAN2(r0.x * r1.y - r0.y * r1.x, r0.x * r1.x + r0.y * r1.y);
+      if (d > 0 && angle < 0) angle += RADIANS(360);
+      else if (d < 0 && angle > 0) angle -= RADIANS(360);
+      if (ABS(angle) > RADIANS(90)) return SPAN_NONE;
+
+      center = p0 + to_center;
+      LOOP_L_N(q, 2) {
+        const float tq = t0 + (q ? 0.75f : 0.25f) * h;
+        if (ABS((bez_point(c, tq) - center).magnitude() - radius) > tol) return SPAN_NONE;
+      }
+      return SPAN_ARC;
+    }
+  #else
+    UNUSED(arcs); UNUSED(center); UNUSED(angle);
+  #endif
+
+  return SPAN_NONE;
+}
+
+/**
+ * Subdivide the curve into spans that stay within BEZIER_CURVE_TOLERANCE
+ * of the true curve. A line span from t to t+h deviates by at most
+ * h^2/8 * max|D2|, which gives a safe span length directly. Longer spans,
+ * lines or (with ARC_BLOCKS) arcs, are tried first, starting from twice
+ * the last span, so gentle curves need only a few blocks.
+ *
+ * Line spans are slowed to the speed where the centripetal acceleration
+ * reaches the X/Y max acceleration. Arc spans get the same limit from
+ * the planner. Z and E are interpolated along the XY distance.
+ */
+void cubic_b_spline(
+  const xyze_pos_t &position,       // current position
+  const xyze_pos_t &target,         // target position
+  const xy_pos_t (&offsets)[2],     // a pair of offsets
+  const_feedRate_t scaled_fr_mm_s,  // mm/s scaled by feedrate %
+  const uint8_t extruder
+) {
+  bezier_t c;
+  c[0] = position; c[1] = c[0] + offsets[0];
+  c[3] = target;   c[2] = c[3] + offsets[1];
+
+  constexpr float tol = BEZIER_CURVE_TOLERANCE;
+  const float accel = _MIN(planner.settings.max_acceleration_mm_per_s2[X_AXIS], planner.settings.max_acceleration_mm_per_s2[Y_AXIS]),
+              length = bez_length(c);
+
+  #if ENABLED(ARC_BLOCKS)
+    // Use arcs if the curve (inside the hull of its control points) can't be clipped by the software endstops
+    bool use_arcs = TERN1(HAS_LEVELING, !planner.leveling_active);
+    if (use_arcs) {
+      xyze_pos_t hull_min = position, hull_max = position;
+      LOOP_L_N(i, 4) {
+        NOMORE(hull_min.x, c[i].x - tol); NOLESS(hull_max.x, c[i].x + tol);
+        NOMORE(hull_min.y, c[i].y - tol); NOLESS(hull_max.y, c[i].y + tol);
+      }
+      #if HAS_Z_AXIS
+        NOMORE(hull_min.z, target.z);
+        NOLESS(hull_max.z, target.z);
+      #endif
+      xyz_pos_t lim_min, lim_max;
+      lim_min = hull_min;
+      lim_max = hull_max;
+      apply_motion_limits(lim_min);
+      apply_motion_limits(lim_max);
+      use_arcs = lim_min == hull_min && lim_max == hull_max;
+    }
+  #else
+    constexpr bool use_arcs = false;
+  #endif
+
+  xyze_pos_t bez_target = position;
+  xy_pos_t p0 = c[0];
+  float done_mm = 0, span_h = 0.5f;
+
+  millis_t next_idle_ms = millis() + 200UL;
+
+  for (float t = 0; t < 1;) {
+
+    thermalManager.manage_heater();
+    millis_t now = millis();
+    if (ELAPSED(now, next_idle_ms)) {
+      next_idle_ms = now + 200UL;
+      idle();
+    }
+
+    // A line span that is sure to be within tolerance
+    float h = 1 - t;
+    const float m0 = bez_d2(c, t).magnitude();
+    if (m0) NOMORE(h, SQRT(8 * tol / m0));
+    const float m1 = bez_d2(c, t + h).magnitude();
+    if (m1 > m0) NOMORE(h, SQRT(8 * tol / m1));
+    NOLESS(h, MIN_STEP);
+
+    // Try for a longer span, starting from twice the last one
+    float new_t = h < 1 - t ? t + h : 1;
+    SpanType span = SPAN_LINE;
+    xy_pos_t center;
+    float angle;
+    float hs = _MIN(2 * span_h, 1 - t);
+    span_h = h;
+    for (; hs > h; hs *= 0.5f) {
+      const float ts = hs < 1 - t ? t + hs : 1;
+      const SpanType fit = bez_fit_span(c, p0, t, ts, use_arcs, center, angle);
+      if (fit) { new_t = ts; span_h = hs; span = fit; break; }
+    }
+    const bool is_arc = span == SPAN_ARC;
+
+    const xy_pos_t p1 = new_t < 1 ? bez_point(c, new_t) : c[3];
+    const float span_mm = TERN_(ARC_BLOCKS, is_arc ? ABS(angle) * (p0 - center).magnitude() :) (p1 - p0).magnitude();
+
+    // Share of Z and E for the XY distance covered so far
+    done_mm += span_mm;
+    const float f = new_t < 1 && length ? _MIN(done_mm / length, 1.0f) : new_t;
+
+    xyze_pos_t new_bez = LOGICAL_AXIS_ARRAY(
+      interp(position.e, target.e, f),
+      p1.x,
+      p1.y,
+      interp(position.z, target.z, f),
+      interp(position.i, target.i, f),
+      interp(position.j, target.j, f),
+      interp(position.k, target.k, f)
+    );
+
+    #if ENABLED(ARC_BLOCKS)
+      if (is_arc) {
+        const float mm = TERN_(HAS_Z_AXIS, new_bez.z != bez_target.z ? HYPOT(span_mm, new_bez.z - bez_target.z) :) span_mm;
+        if (!planner.buffer_arc(new_bez, center, angle, scaled_fr_mm_s, extruder, mm)) break;
+      }
+    #endif
+
+    if (!is_arc) {
+      // Slow down for the tightest curvature along the span
+      float fr_mm_s = scaled_fr_mm_s;
+      bez_limit_speed(fr_mm_s, c, t, accel);
+      bez_limit_speed(fr_mm_s, c, 0.5f * (t + new_t), accel);
+      bez_limit_speed(fr_mm_s, c, new_t, accel);
+      NOLESS(fr_mm_s, _MIN(planner.settings.min_feedrate_mm_s, scaled_fr_mm_s));
+
+      apply_motion_limits(new_bez);
+
+      #if HAS_LEVELING && !PLANNER_LEVELING
+        xyze_pos_t pos = new_bez;
+        planner.apply_leveling(pos);
+      #else
+        const xyze_pos_t &pos = new_bez;
+      #endif
+
+      if (!planner.buffer_line(pos, fr_mm_s, extruder)) break;
+    }
+
+    bez_target = new_bez;
+    p0 = p1;
+    t = new_t;
+  }
+}
+
+#else // !BEZIER_CURVE_TOLERANCE
+
 /**
  * We approximate Euclidean distance with the sum of the coordinates
  * offset (so-called "norm 1"), which is quicker to compute.
@@ -205,4 +445,6 @@ void cubic_b_spline(
   }
 }
 
+#endif // !BEZIER_CURVE_TOLERANCE
+
 #endif // BEZIER_CURVE_SUPPORT
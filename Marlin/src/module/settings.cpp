@@ -36,7 +36,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V84"
+#define EEPROM_VERSION "V85"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -448,6 +448,13 @@ typedef struct SettingsDataStruct {
     uint8_t caselight_brightness;                        // M355 P
   #endif
 
+  //
+  // INPUT_SHAPING_X / INPUT_SHAPING_Y
+  //
+  #if HAS_SHAPING
+    shaping_params_t shaping_params[XY];                 // M593 X Y F D T
+  #endif
+
   //
   // PASSWORD_FEATURE
   //
@@ -546,6 +553,8 @@ void MarlinSettings::postprocess() {
 
   TERN_(CASELIGHT_USES_BRIGHTNESS, caselight.update_brightness());
 
+  TERN_(HAS_SHAPING, stepper.refresh_shaping());
+
   TERN_(EXTENSIBLE_UI, ExtUI::onPostprocessSettings());
 
   // Refresh steps_to_mm with the reciprocal of axis_steps_per_mm
@@ -1353,6 +1362,13 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(caselight.brightness);
     #endif
 
+    //
+    // Input Shaping
+    //
+    #if HAS_SHAPING
+      EEPROM_WRITE(stepper.shaping_params);
+    #endif
+
     //
     // Password feature
     //
@@ -2233,6 +2249,18 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(caselight.brightness);
       #endif
 
+      //
+      // Input Shaping
+      //
+      #if HAS_SHAPING
+      {
+        shaping_params_t shaping_params[XY];
+        _FIELD_TEST(shaping_params);
+        EEPROM_READ(shaping_params);
+        if (!validating) COPY(stepper.shaping_params, shaping_params);
+      }
+      #endif
+
       //
       // Password feature
       //
@@ -2487,6 +2515,8 @@ void MarlinSettings::postprocess() {
             ubl.set_mesh_from_store(z_mesh_store, ubl.z_values);
         #endif
 
+        TERN_(UBL_CELL_CACHE, if (!into) ubl.refresh_cells());
+
         if (status) SERIAL_ECHOLNPGM("?Unable to load mesh data.");
         else        DEBUG_ECHOLNPAIR("Mesh loaded from slot ", slot);
 
@@ -2627,6 +2657,16 @@ void MarlinSettings::reset() {
   //
   TERN_(CASELIGHT_USES_BRIGHTNESS, caselight.brightness = CASE_LIGHT_DEFAULT_BRIGHTNESS);
 
+  //
+  // Input Shaping
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    stepper.shaping_params[X_AXIS] = { SHAPING_FREQ_X, SHAPING_ZETA_X, SHAPING_TYPE_X };
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    stepper.shaping_params[Y_AXIS] = { SHAPING_FREQ_Y, SHAPING_ZETA_Y, SHAPING_TYPE_Y };
+  #endif
+
   //
   // TOUCH_SCREEN_CALIBRATION
   //
@@ -3799,6 +3839,16 @@ void MarlinSettings::reset() {
       #endif
     #endif
 
+    #if HAS_SHAPING
+      CONFIG_ECHO_HEADING("Input Shaping:");
+      #if ENABLED(INPUT_SHAPING_X)
+        CONFIG_ECHO_MSG("  M593 X F", stepper.shaping_params[X_AXIS].frequency, " D", stepper.shaping_params[X_AXIS].zeta, " T", stepper.shaping_params[X_AXIS].type);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        CONFIG_ECHO_MSG("  M593 Y F", stepper.shaping_params[Y_AXIS].frequency, " D", stepper.shaping_params[Y_AXIS].zeta, " T", stepper.shaping_params[Y_AXIS].type);
+      #endif
+    #endif
+
     #if EITHER(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_PWM)
       CONFIG_ECHO_HEADING("Stepper motor currents:");
       CONFIG_ECHO_START();
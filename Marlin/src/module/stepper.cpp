@@ -131,6 +131,17 @@ Stepper stepper; // Singleton
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+  #include "../libs/cycle_counter.h"
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+  #include "../feature/stepper_profile.h"
+  #define ISR_PROBE(P) StepperProfile::Probe isr_probe(StepperProfile::P)
+#else
+  #define ISR_PROBE(P) NOOP
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -210,19 +221,34 @@ uint32_t Stepper::advance_divisor = 0,
     bool __attribute__((used)) Stepper::A_negative __asm__("A_negative"); // If A coefficient was negative
   #endif
   bool Stepper::bezier_2nd_half;    // =false If Bézier curve has been initialized or not
+
+  #ifdef __AVR__
+    #define BLOCK_TIME_INVERSE(T) current_block->T##_time_inverse
+  #else
+    // Other CPUs get 0x100000000 / t ~= 0xFFFFFFFF / t with a single hardware division
+    #define BLOCK_TIME_INVERSE(T) (current_block->T##_time ? 0xFFFFFFFF / current_block->T##_time : 0xFFFFFFFF)
+  #endif
 #endif
 
 #if ENABLED(LIN_ADVANCE)
 
-  uint32_t Stepper::nextAdvanceISR = LA_ADV_NEVER,
-           Stepper::LA_isr_rate = LA_ADV_NEVER;
-  uint16_t Stepper::LA_current_adv_steps = 0,
-           Stepper::LA_final_adv_steps,
-           Stepper::LA_max_adv_steps;
+  uint32_t Stepper::nextAdvanceISR = LA_ADV_NEVER;
 
-  int8_t   Stepper::LA_steps = 0;
+  #if ENABLED(LA_PRESSURE_PROFILE)
+    float    Stepper::advance_smooth_time; // Initialized by init()
+    uint32_t Stepper::LA_advance_rate = 0,
+             Stepper::LA_smooth_k = 0;
+    int32_t  Stepper::LA_pressure = 0,
+             Stepper::LA_adv_steps = 0;
+  #else
+    uint32_t Stepper::LA_isr_rate = LA_ADV_NEVER;
+    uint16_t Stepper::LA_current_adv_steps = 0,
+             Stepper::LA_final_adv_steps,
+             Stepper::LA_max_adv_steps;
+    bool Stepper::LA_use_advance_lead;
+  #endif
 
-  bool Stepper::LA_use_advance_lead;
+  int8_t   Stepper::LA_steps = 0;
 
 #endif // LIN_ADVANCE
 
@@ -230,16 +256,51 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(BACKLASH_STREAM)
+  #define BACKLASH_STREAM_TICKS ((STEPPER_TIMER_RATE) / (BACKLASH_STREAM_RATE))
+  uint32_t Stepper::nextBacklashISR = BACKLASH_NEVER;
+  xyz_ulong_t Stepper::backlash_todo{0};
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+  int32_t Stepper::arc_u, Stepper::arc_v,
+          Stepper::arc_ox, Stepper::arc_oy,
+          Stepper::arc_x, Stepper::arc_y;
+#endif
+
+#if HAS_SHAPING
+  shaping_params_t Stepper::shaping_params[XY];
+  uint32_t Stepper::nextShapingISR = SHAPING_NEVER,
+           Stepper::shaping_time = 0;
+  #if ENABLED(INPUT_SHAPING_X)
+    shaping_t Stepper::shaping_x;
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    shaping_t Stepper::shaping_y;
+  #endif
+#endif
+
 int32_t Stepper::ticks_nominal = -1;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
 #endif
 
+#if ENABLED(STEP_TIMING_TABLE)
+  Stepper::step_timing_t Stepper::step_timing[STEP_TIMING_BLOCKS];
+  const Stepper::step_timing_t *Stepper::current_timing; // = nullptr
+  const uint32_t *Stepper::timing_ramp;                  // = nullptr
+  uint8_t Stepper::timing_left;                          // = 0
+#endif
+
 xyz_long_t Stepper::endstops_trigsteps;
+#if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+  uint32_t Stepper::pulse_cycles, Stepper::pulse_period;
+  uint8_t Stepper::pulse_events;
+#endif
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
 
@@ -460,6 +521,24 @@ xyze_int8_t Stepper::count_direction{0};
   #define DIR_WAIT_AFTER()
 #endif
 
+#if HAS_SHAPING
+  #define _SHAPING_X shaping_x
+  #define _SHAPING_Y shaping_y
+  #define SHAPING(A) _SHAPING_##A
+
+  // Take the physical step due on a shaped axis, setting its direction pin if needed
+  #define SHAPED_STEP_PREP(A) do{ \
+    const int8_t s = SHAPING(A).settle(); \
+    step_needed[_AXIS(A)] = s; \
+    if (s && (s > 0) != SHAPING(A).forward) { \
+      SHAPING(A).forward = (s > 0); \
+      DIR_WAIT_BEFORE(); \
+      A##_APPLY_DIR(SHAPING(A).forward != INVERT_##A##_DIR, false); \
+      DIR_WAIT_AFTER(); \
+    } \
+  }while(0)
+#endif
+
 /**
  * Set the stepper direction of each axis
  *
@@ -481,10 +560,17 @@ void Stepper::set_directions() {
       count_direction[_AXIS(A)] = 1;            \
     }
 
-  #if HAS_X_DIR
+  // Input Shaping sets the direction pins with each physical step
+  #define SET_SHAPED_DIR(A) count_direction[_AXIS(A)] = motor_direction(_AXIS(A)) ? -1 : 1
+
+  #if ENABLED(INPUT_SHAPING_X)
+    SET_SHAPED_DIR(X);
+  #elif HAS_X_DIR
     SET_STEP_DIR(X); // A
   #endif
-  #if HAS_Y_DIR
+  #if ENABLED(INPUT_SHAPING_Y)
+    SET_SHAPED_DIR(Y);
+  #elif HAS_Y_DIR
     SET_STEP_DIR(Y); // B
   #endif
   #if HAS_Z_DIR
@@ -1288,18 +1374,16 @@ void Stepper::set_directions() {
       bezier_AV = av;
     }
 
-    FORCE_INLINE int32_t Stepper::_eval_bezier_curve(const uint32_t curr_step) {
+    // Evaluate a curve with the given coefficients. Also used by the main loop (See build_step_timing).
+    FORCE_INLINE int32_t Stepper::_eval_bezier_curve(int32_t A, int32_t B, int32_t C, const uint32_t F, const uint32_t AV, const uint32_t curr_step) {
       #if defined(__arm__) || defined(__thumb__)
 
         // For ARM Cortex M3/M4 CPUs, we have the optimized assembler version, that takes 43 cycles to execute
         uint32_t flo = 0;
-        uint32_t fhi = bezier_AV * curr_step;
+        uint32_t fhi = AV * curr_step;
         uint32_t t = fhi;
-        int32_t alo = bezier_F;
+        int32_t alo = F;
         int32_t ahi = 0;
-        int32_t A = bezier_A;
-        int32_t B = bezier_B;
-        int32_t C = bezier_C;
 
          __asm__ __volatile__(
           ".syntax unified" "\n\t"              // is to prevent CM0,CM1 non-unified syntax
@@ -1334,25 +1418,29 @@ void Stepper::set_directions() {
         // For non ARM targets, we provide a fallback implementation. Really doubt it
         // will be useful, unless the processor is fast and 32bit
 
-        uint32_t t = bezier_AV * curr_step;               // t: Range 0 - 1^32 = 32 bits
+        uint32_t t = AV * curr_step;                      // t: Range 0 - 1^32 = 32 bits
         uint64_t f = t;
         f *= t;                                           // Range 32*2 = 64 bits (unsigned)
         f >>= 32;                                         // Range 32 bits  (unsigned)
         f *= t;                                           // Range 32*2 = 64 bits  (unsigned)
         f >>= 32;                                         // Range 32 bits : f = t^3  (unsigned)
-        int64_t acc = (int64_t) bezier_F << 31;           // Range 63 bits (signed)
-        acc += ((uint32_t) f >> 1) * (int64_t) bezier_C;  // Range 29bits + 31 = 60bits (plus sign)
+        int64_t acc = (int64_t) F << 31;                  // Range 63 bits (signed)
+        acc += ((uint32_t) f >> 1) * (int64_t) C;         // Range 29bits + 31 = 60bits (plus sign)
         f *= t;                                           // Range 32*2 = 64 bits
         f >>= 32;                                         // Range 32 bits : f = t^3  (unsigned)
-        acc += ((uint32_t) f >> 1) * (int64_t) bezier_B;  // Range 29bits + 31 = 60bits (plus sign)
+        acc += ((uint32_t) f >> 1) * (int64_t) B;         // Range 29bits + 31 = 60bits (plus sign)
         f *= t;                                           // Range 32*2 = 64 bits
         f >>= 32;                                         // Range 32 bits : f = t^3  (unsigned)
-        acc += ((uint32_t) f >> 1) * (int64_t) bezier_A;  // Range 28bits + 31 = 59bits (plus sign)
+        acc += ((uint32_t) f >> 1) * (int64_t) A;         // Range 28bits + 31 = 59bits (plus sign)
         acc >>= (31 + 7);                                 // Range 24bits (plus sign)
         return (int32_t) acc;
 
       #endif
     }
+
+    FORCE_INLINE int32_t Stepper::_eval_bezier_curve(const uint32_t curr_step) {
+      return _eval_bezier_curve(bezier_A, bezier_B, bezier_C, bezier_F, bezier_AV, curr_step);
+    }
   #endif
 #endif // S_CURVE_ACCELERATION
 
@@ -1378,6 +1466,8 @@ HAL_STEP_TIMER_ISR() {
 
 void Stepper::isr() {
 
+  ISR_PROBE(STEPPER_ISR);
+
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
   #ifndef __AVR__
@@ -1405,6 +1495,11 @@ void Stepper::isr() {
 
     if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
 
+    #if HAS_SHAPING
+      // 0 = Replay Input Shaping echoes. Reschedule after new steps were queued.
+      if (!nextShapingISR || !nextMainISR) nextShapingISR = shaping_isr();
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
       if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
     #endif
@@ -1414,15 +1509,25 @@ void Stepper::isr() {
       if (is_babystep) nextBabystepISR = babystepping_isr();
     #endif
 
+    #if ENABLED(BACKLASH_STREAM)
+      if (!nextBacklashISR) nextBacklashISR = backlash_isr();       // 0 = Do Backlash takeup pulses
+    #endif
+
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
     if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
-      if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
+      #if ENABLED(BABYSTEP_SMOOTHING) && IS_CARTESIAN && !IS_CORE && DISABLED(BABYSTEP_XY)
+        const bool babystep_holds = axis_is_moving(Z_AXIS); // Z babysteps can't disturb the other steppers
+      #else
+        constexpr bool babystep_holds = true;
+      #endif
+
+      if (is_babystep && babystep_holds)                // Avoid ANY stepping too soon after baby-stepping
         NOLESS(nextMainISR, (BABYSTEP_TICKS) / 8);      // FULL STOP for 125µs after a baby-step
 
-      if (nextBabystepISR != BABYSTEP_NEVER)            // Avoid baby-stepping too close to axis Stepping
+      if (nextBabystepISR != BABYSTEP_NEVER && babystep_holds) // Avoid baby-stepping too close to axis Stepping
         NOLESS(nextBabystepISR, nextMainISR / 2);       // TODO: Only look at axes enabled for baby-stepping
     #endif
 
@@ -1432,9 +1537,15 @@ void Stepper::isr() {
       #if ENABLED(LIN_ADVANCE)
         , nextAdvanceISR                                // Come back early for Linear Advance?
       #endif
+      #if HAS_SHAPING
+        , nextShapingISR                                // Come back early for Input Shaping?
+      #endif
       #if ENABLED(INTEGRATED_BABYSTEPPING)
         , nextBabystepISR                               // Come back early for Babystepping?
       #endif
+      #if ENABLED(BACKLASH_STREAM)
+        , nextBacklashISR                               // Come back early for Backlash takeup?
+      #endif
       , uint32_t(HAL_TIMER_TYPE_MAX)                    // Come back in a very long time
     );
 
@@ -1451,10 +1562,19 @@ void Stepper::isr() {
       if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
     #endif
 
+    #if HAS_SHAPING
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      shaping_time += interval;
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    #if ENABLED(BACKLASH_STREAM)
+      if (nextBacklashISR != BACKLASH_NEVER) nextBacklashISR -= interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1543,10 +1663,13 @@ void Stepper::isr() {
  */
 void Stepper::pulse_phase_isr() {
 
+  ISR_PROBE(PULSE_PHASE);
+
   // If we must abort the current block, do so!
   if (abort_current_block) {
     abort_current_block = false;
     if (current_block) discard_current_block();
+    TERN_(BACKLASH_STREAM, backlash_todo.reset());
   }
 
   // If there is no current block, do nothing
@@ -1559,6 +1682,24 @@ void Stepper::pulse_phase_isr() {
   const uint32_t pending_events = step_event_count - step_events_completed;
   uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
 
+  #if HAS_SHAPING
+    // Don't overrun the echo queues. Motion waits for queued steps to be replayed.
+    #if ENABLED(INPUT_SHAPING_X)
+      if (shaping_x.active) NOMORE(events_to_do, shaping_x.free_count());
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+      if (shaping_y.active) NOMORE(events_to_do, shaping_y.free_count());
+    #endif
+    if (!events_to_do) return;
+  #endif
+
+  #if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+    const uint32_t now = cycle_count();
+    pulse_period = now - pulse_cycles;
+    pulse_cycles = now;
+    pulse_events = events_to_do;
+  #endif
+
   // Just update the value we will get at the end of the loop
   step_events_completed += events_to_do;
 
@@ -1583,6 +1724,17 @@ void Stepper::pulse_phase_isr() {
       } \
     }while(0)
 
+    // Determine if a pulse is needed using Bresenham and Input Shaping
+    #define SHAPED_PULSE_PREP(AXIS) do{ \
+      delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
+      if (delta_error[_AXIS(AXIS)] >= 0) { \
+        count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        delta_error[_AXIS(AXIS)] -= advance_divisor; \
+        SHAPING(AXIS).command(count_direction[_AXIS(AXIS)] > 0, shaping_time); \
+      } \
+      SHAPED_STEP_PREP(AXIS); \
+    }while(0)
+
     // Start an active pulse if needed
     #define PULSE_START(AXIS) do{ \
       if (step_needed[_AXIS(AXIS)]) { \
@@ -1706,14 +1858,91 @@ void Stepper::pulse_phase_isr() {
 
     #endif // DIRECT_STEPPING
 
+    #if ENABLED(ARC_BLOCKS)
+
+      // Set the direction pin of an axis reversed by the circle interpolator
+      #define ARC_DIR_PREP(AXIS, D) do{ \
+        DIR_WAIT_BEFORE(); \
+        AXIS##_APPLY_DIR(((D) > 0) != INVERT_##AXIS##_DIR, false); \
+        DIR_WAIT_AFTER(); \
+      }while(0)
+
+      // Determine if a pulse is needed from the circle interpolator
+      #define ARC_PULSE_PREP(AXIS, D) do{ \
+        const int8_t d = D; \
+        step_needed[_AXIS(AXIS)] = d; \
+        if (d) { \
+          if (d != count_direction[_AXIS(AXIS)]) { \
+            count_direction[_AXIS(AXIS)] = d; \
+            TBI(last_direction_bits, _AXIS(AXIS)); \
+            ARC_DIR_PREP(AXIS, d); \
+          } \
+          count_position[_AXIS(AXIS)] += d; \
+        } \
+      }while(0)
+
+      // Determine if a pulse is needed from the circle interpolator and Input Shaping
+      #define SHAPED_ARC_PULSE_PREP(AXIS, D) do{ \
+        const int8_t d = D; \
+        if (d) { \
+          if (d != count_direction[_AXIS(AXIS)]) { \
+            count_direction[_AXIS(AXIS)] = d; \
+            TBI(last_direction_bits, _AXIS(AXIS)); \
+          } \
+          count_position[_AXIS(AXIS)] += d; \
+          SHAPING(AXIS).command(d > 0, shaping_time); \
+        } \
+        SHAPED_STEP_PREP(AXIS); \
+      }while(0)
+
+    #endif // ARC_BLOCKS
+
     if (!is_page) {
       // Determine if pulses are needed
-      #if HAS_X_STEP
-        PULSE_PREP(X);
-      #endif
-      #if HAS_Y_STEP
-        PULSE_PREP(Y);
+      #if ENABLED(ARC_BLOCKS)
+        if (IS_ARC(current_block)) {
+          // Turn the radius by one step event and find the whole steps due.
+          // The last event lands exactly on the block's target.
+          const block_arc_t &arc = current_block->arc;
+          const int32_t u = arc_u, v = arc_v;
+          const int64_t half = int64_t(1) << (arc.shift - 1);
+          arc_u = u - int32_t((int64_t(u) * arc.k + int64_t(v) * arc.sxy + half) >> arc.shift);
+          arc_v = v + int32_t((int64_t(u) * arc.syx - int64_t(v) * arc.k + half) >> arc.shift);
+          arc_ox += arc.cx;
+          arc_oy += arc.cy;
+
+          const bool last = events_to_do == 1 && step_events_completed == step_event_count;
+          const int32_t x = last ? arc.dx : (arc_u + arc_ox) >> (ARC_FRAC_BITS),
+                        y = last ? arc.dy : (arc_v + arc_oy) >> (ARC_FRAC_BITS);
+          const int8_t dx = constrain(x - arc_x, -1, 1), dy = constrain(y - arc_y, -1, 1);
+          arc_x += dx;
+          arc_y += dy;
+
+          #if ENABLED(INPUT_SHAPING_X)
+            SHAPED_ARC_PULSE_PREP(X, dx);
+          #else
+            ARC_PULSE_PREP(X, dx);
+          #endif
+          #if ENABLED(INPUT_SHAPING_Y)
+            SHAPED_ARC_PULSE_PREP(Y, dy);
+          #else
+            ARC_PULSE_PREP(Y, dy);
+          #endif
+        }
+        else
       #endif
+      {
+        #if ENABLED(INPUT_SHAPING_X)
+          SHAPED_PULSE_PREP(X);
+        #elif HAS_X_STEP
+          PULSE_PREP(X);
+        #endif
+        #if ENABLED(INPUT_SHAPING_Y)
+          SHAPED_PULSE_PREP(Y);
+        #elif HAS_Y_STEP
+          PULSE_PREP(Y);
+        #endif
+      }
       #if HAS_Z_STEP
         PULSE_PREP(Z);
       #endif
@@ -1833,6 +2062,8 @@ void Stepper::pulse_phase_isr() {
 
 uint32_t Stepper::block_phase_isr() {
 
+  ISR_PROBE(BLOCK_PHASE);
+
   // If no queued movements, just wait 1ms for the next block
   uint32_t interval = (STEPPER_TIMER_RATE) / 1000UL;
 
@@ -1868,22 +2099,49 @@ uint32_t Stepper::block_phase_isr() {
       if (step_events_completed <= accelerate_until) { // Calculate new timer value
 
         #if ENABLED(S_CURVE_ACCELERATION)
-          // Get the next speed to use (Jerk limited!)
-          uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
-                                   ? _eval_bezier_curve(acceleration_time)
-                                   : current_block->cruise_rate;
-        #else
-          acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
-          NOMORE(acc_step_rate, current_block->nominal_rate);
+          uint32_t acc_step_rate;
         #endif
 
-        // acc_step_rate is in steps/second
+        #if ENABLED(STEP_TIMING_TABLE)
+          if (timing_left) {
+            // Take the interval computed ahead by the main loop
+            interval = next_timing_interval();
+            #if DISABLED(S_CURVE_ACCELERATION)
+              // Still needed as the deceleration start point
+              acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
+              NOMORE(acc_step_rate, current_block->nominal_rate);
+            #endif
+          }
+          else
+        #endif
+        {
+          #if ENABLED(S_CURVE_ACCELERATION)
+            #if ENABLED(STEP_TIMING_TABLE)
+              // The prepared ramp ran out. Set up the Bézier curve to go on.
+              if (timing_ramp) {
+                _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, BLOCK_TIME_INVERSE(acceleration));
+                timing_ramp = nullptr;
+              }
+            #endif
+            // Get the next speed to use (Jerk limited!)
+            acc_step_rate = acceleration_time < current_block->acceleration_time
+                            ? _eval_bezier_curve(acceleration_time)
+                            : current_block->cruise_rate;
+          #else
+            acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
+            NOMORE(acc_step_rate, current_block->nominal_rate);
+          #endif
+
+          // acc_step_rate is in steps/second
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
+          // step_rate to timer interval and steps per stepper isr
+          interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
+        }
         acceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LA_PRESSURE_PROFILE)
+          advance_track(interval);
+        #elif ENABLED(LIN_ADVANCE)
           if (LA_use_advance_lead) {
             // Fire ISR if final adv_rate is reached
             if (LA_steps && LA_isr_rate != current_block->advance_speed) nextAdvanceISR = 0;
@@ -1924,40 +2182,62 @@ uint32_t Stepper::block_phase_isr() {
       else if (step_events_completed > decelerate_after) {
         uint32_t step_rate;
 
-        #if ENABLED(S_CURVE_ACCELERATION)
-          // If this is the 1st time we process the 2nd half of the trapezoid...
-          if (!bezier_2nd_half) {
-            // Initialize the Bézier speed curve
-            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+        #if BOTH(S_CURVE_ACCELERATION, STEP_TIMING_TABLE)
+          // Stream the deceleration ramp prepared by the main loop, if any
+          if (!bezier_2nd_half && current_timing) {
+            timing_ramp = current_timing->decel;
+            timing_left = STEP_TIMING_TABLE_SIZE;
             bezier_2nd_half = true;
-            // The first point starts at cruise rate. Just save evaluation of the Bézier curve
-            step_rate = current_block->cruise_rate;
-          }
-          else {
-            // Calculate the next speed to use
-            step_rate = deceleration_time < current_block->deceleration_time
-              ? _eval_bezier_curve(deceleration_time)
-              : current_block->final_rate;
-          }
-        #else
-
-          // Using the old trapezoidal control
-          step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
-          if (step_rate < acc_step_rate) { // Still decelerating?
-            step_rate = acc_step_rate - step_rate;
-            NOLESS(step_rate, current_block->final_rate);
           }
+          if (timing_left)
+            interval = next_timing_interval();
           else
-            step_rate = current_block->final_rate;
         #endif
+        {
+          #if ENABLED(S_CURVE_ACCELERATION)
+            #if ENABLED(STEP_TIMING_TABLE)
+              // The prepared ramp ran out. Set up the Bézier curve to go on.
+              if (timing_ramp) {
+                _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, BLOCK_TIME_INVERSE(deceleration));
+                timing_ramp = nullptr;
+              }
+            #endif
+            // If this is the 1st time we process the 2nd half of the trapezoid...
+            if (!bezier_2nd_half) {
+              // Initialize the Bézier speed curve
+              _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, BLOCK_TIME_INVERSE(deceleration));
+              bezier_2nd_half = true;
+              // The first point starts at cruise rate. Just save evaluation of the Bézier curve
+              step_rate = current_block->cruise_rate;
+            }
+            else {
+              // Calculate the next speed to use
+              step_rate = deceleration_time < current_block->deceleration_time
+                ? _eval_bezier_curve(deceleration_time)
+                : current_block->final_rate;
+            }
+          #else
 
-        // step_rate is in steps/second
+            // Using the old trapezoidal control
+            step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
+            if (step_rate < acc_step_rate) { // Still decelerating?
+              step_rate = acc_step_rate - step_rate;
+              NOLESS(step_rate, current_block->final_rate);
+            }
+            else
+              step_rate = current_block->final_rate;
+          #endif
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(step_rate, &steps_per_isr);
+          // step_rate is in steps/second
+
+          // step_rate to timer interval and steps per stepper isr
+          interval = calc_timer_interval(step_rate, &steps_per_isr);
+        }
         deceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LA_PRESSURE_PROFILE)
+          advance_track(interval);
+        #elif ENABLED(LIN_ADVANCE)
           if (LA_use_advance_lead) {
             // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
             if (step_events_completed <= decelerate_after + steps_per_isr || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
@@ -2000,13 +2280,18 @@ uint32_t Stepper::block_phase_isr() {
       // Must be in cruise phase otherwise
       else {
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LIN_ADVANCE) && DISABLED(LA_PRESSURE_PROFILE)
           // If there are any esteps, fire the next advance_isr "now"
           if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
         #endif
 
         // Calculate the ticks_nominal for this nominal speed, if not done yet
         if (ticks_nominal < 0) {
+          #if ENABLED(STEP_TIMING_TABLE)
+            if (current_timing)
+              ticks_nominal = timing_interval(current_timing->nominal);
+            else
+          #endif
           // step_rate to timer interval and loops for the nominal speed
           ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
         }
@@ -2014,6 +2299,8 @@ uint32_t Stepper::block_phase_isr() {
         // The timer interval is just the nominal value for the nominal speed
         interval = ticks_nominal;
 
+        TERN_(LA_PRESSURE_PROFILE, advance_track(interval));
+
         // Update laser - Cruising
         #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
           if (laser_trap.enabled) {
@@ -2033,6 +2320,11 @@ uint32_t Stepper::block_phase_isr() {
     }
   }
 
+  #if ENABLED(BACKLASH_STREAM)
+    // The next block may reverse an axis, so let the takeup finish first
+    if (!current_block && nextBacklashISR != BACKLASH_NEVER) return _MAX(nextBacklashISR, BACKLASH_STREAM_TICKS);
+  #endif
+
   // If there is no current block at this point, attempt to pop one from the buffer
   // and prepare its movement
   if (!current_block) {
@@ -2166,14 +2458,9 @@ uint32_t Stepper::block_phase_isr() {
       acceleration_time = deceleration_time = 0;
 
       #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
-        uint8_t oversampling = 0;                           // Assume no axis smoothing (via oversampling)
         // Decide if axis smoothing is possible
-        uint32_t max_rate = current_block->nominal_rate;    // Get the step event rate
-        while (max_rate < MIN_STEP_ISR_FREQUENCY) {         // As long as more ISRs are possible...
-          max_rate <<= 1;                                   // Try to double the rate
-          if (max_rate < MIN_STEP_ISR_FREQUENCY)            // Don't exceed the estimated ISR limit
-            ++oversampling;                                 // Increase the oversampling (used for left-shift)
-        }
+        // Arc blocks are traced one interpolator event per step event
+        const uint8_t oversampling = IS_ARC(current_block) ? 0 : calc_oversampling(current_block->nominal_rate);
         oversampling_factor = oversampling;                 // For all timer interval calculations
       #else
         constexpr uint8_t oversampling = 0;
@@ -2192,6 +2479,18 @@ uint32_t Stepper::block_phase_isr() {
       // No step events completed so far
       step_events_completed = 0;
 
+      #if ENABLED(ARC_BLOCKS)
+        // Start the circle interpolator
+        if (IS_ARC(current_block)) {
+          const block_arc_t &arc = current_block->arc;
+          arc_u = arc.u;
+          arc_v = arc.v;
+          arc_ox = arc.ox;
+          arc_oy = arc.oy;
+          arc_x = arc_y = 0;
+        }
+      #endif
+
       // Compute the acceleration and deceleration points
       accelerate_until = current_block->accelerate_until << oversampling;
       decelerate_after = current_block->decelerate_after << oversampling;
@@ -2204,16 +2503,27 @@ uint32_t Stepper::block_phase_isr() {
       #if ENABLED(LIN_ADVANCE)
         #if DISABLED(MIXING_EXTRUDER) && E_STEPPERS > 1
           // If the now active extruder wasn't in use during the last move, its pressure is most likely gone.
-          if (stepper_extruder != last_moved_extruder) LA_current_adv_steps = 0;
+          if (stepper_extruder != last_moved_extruder) {
+            #if ENABLED(LA_PRESSURE_PROFILE)
+              LA_pressure = LA_adv_steps = 0;
+            #else
+              LA_current_adv_steps = 0;
+            #endif
+          }
         #endif
 
-        if ((LA_use_advance_lead = current_block->use_advance_lead)) {
-          LA_final_adv_steps = current_block->final_adv_steps;
-          LA_max_adv_steps = current_block->max_adv_steps;
-          initiateLA(); // Start the ISR
-          LA_isr_rate = current_block->advance_speed;
-        }
-        else LA_isr_rate = LA_ADV_NEVER;
+        #if ENABLED(LA_PRESSURE_PROFILE)
+          // The advance now follows the speed of this block
+          LA_advance_rate = current_block->use_advance_lead ? current_block->advance_rate : 0;
+        #else
+          if ((LA_use_advance_lead = current_block->use_advance_lead)) {
+            LA_final_adv_steps = current_block->final_adv_steps;
+            LA_max_adv_steps = current_block->max_adv_steps;
+            initiateLA(); // Start the ISR
+            LA_isr_rate = current_block->advance_speed;
+          }
+          else LA_isr_rate = LA_ADV_NEVER;
+        #endif
       #endif
 
       if ( ENABLED(HAS_L64XX)       // Always set direction for L64xx (Also enables the chips)
@@ -2226,6 +2536,21 @@ uint32_t Stepper::block_phase_isr() {
         set_directions(current_block->direction_bits);
       }
 
+      #if ENABLED(BACKLASH_STREAM)
+        // Take up the backlash of reversed axes alongside the block
+        if (current_block->backlash_steps.x || current_block->backlash_steps.y || current_block->backlash_steps.z) {
+          backlash_todo = current_block->backlash_steps;
+          nextBacklashISR = 0;
+        }
+      #endif
+
+      #if HAS_SHAPING
+        // Don't shape moves that an endstop may cut short
+        const bool shape = !endstops.abort_enabled();
+        TERN_(INPUT_SHAPING_X, shaping_x.active = shape && shaping_x.enabled);
+        TERN_(INPUT_SHAPING_Y, shaping_y.active = shape && shaping_y.enabled);
+      #endif
+
       #if ENABLED(LASER_POWER_INLINE)
         const power_status_t stat = current_block->laser.status;
         #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
@@ -2276,9 +2601,19 @@ uint32_t Stepper::block_phase_isr() {
       // Mark the time_nominal as not calculated yet
       ticks_nominal = -1;
 
+      #if ENABLED(STEP_TIMING_TABLE)
+        // Use the step timing prepared by the main loop, if any
+        current_timing = TEST(current_block->flag, BLOCK_BIT_STEP_TIMING)
+          ? &step_timing[(current_block - planner.block_buffer) & (STEP_TIMING_BLOCKS - 1)]
+          : nullptr;
+        timing_ramp = current_timing ? current_timing->accel : nullptr;
+        timing_left = current_timing ? STEP_TIMING_TABLE_SIZE : 0;
+      #endif
+
       #if ENABLED(S_CURVE_ACCELERATION)
-        // Initialize the Bézier speed curve
-        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
+        // Initialize the Bézier speed curve, unless it was done ahead
+        if (TERN1(STEP_TIMING_TABLE, !current_timing))
+          _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, BLOCK_TIME_INVERSE(acceleration));
         // We haven't started the 2nd half of the trapezoid
         bezier_2nd_half = false;
       #else
@@ -2287,6 +2622,11 @@ uint32_t Stepper::block_phase_isr() {
       #endif
 
       // Calculate the initial timer interval
+      #if ENABLED(STEP_TIMING_TABLE)
+        if (current_timing)
+          interval = timing_interval(current_timing->initial);
+        else
+      #endif
       interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
     }
     #if ENABLED(LASER_POWER_INLINE_CONTINUOUS)
@@ -2314,24 +2654,31 @@ uint32_t Stepper::block_phase_isr() {
 
   // Timer interrupt for E. LA_steps is set in the main routine
   uint32_t Stepper::advance_isr() {
-    uint32_t interval;
+    ISR_PROBE(ADVANCE_PHASE);
 
-    if (LA_use_advance_lead) {
-      if (step_events_completed > decelerate_after && LA_current_adv_steps > LA_final_adv_steps) {
-        LA_steps--;
-        LA_current_adv_steps--;
-        interval = LA_isr_rate;
-      }
-      else if (step_events_completed < decelerate_after && LA_current_adv_steps < LA_max_adv_steps) {
-        LA_steps++;
-        LA_current_adv_steps++;
-        interval = LA_isr_rate;
+    #if ENABLED(LA_PRESSURE_PROFILE)
+      // The block phase queues the advance steps. Just issue them.
+      constexpr uint32_t interval = LA_ADV_NEVER;
+    #else
+      uint32_t interval;
+
+      if (LA_use_advance_lead) {
+        if (step_events_completed > decelerate_after && LA_current_adv_steps > LA_final_adv_steps) {
+          LA_steps--;
+          LA_current_adv_steps--;
+          interval = LA_isr_rate;
+        }
+        else if (step_events_completed < decelerate_after && LA_current_adv_steps < LA_max_adv_steps) {
+          LA_steps++;
+          LA_current_adv_steps++;
+          interval = LA_isr_rate;
+        }
+        else
+          interval = LA_isr_rate = LA_ADV_NEVER;
       }
       else
-        interval = LA_isr_rate = LA_ADV_NEVER;
-    }
-    else
-      interval = LA_ADV_NEVER;
+        interval = LA_ADV_NEVER;
+    #endif
 
     if (!LA_steps) return interval; // Leave pins alone if there are no steps!
 
@@ -2414,14 +2761,229 @@ uint32_t Stepper::block_phase_isr() {
     return interval;
   }
 
+  #if ENABLED(LA_PRESSURE_PROFILE)
+
+    /**
+     * The pressure advance of a block is proportional to its speed, so the planner provides just
+     * the ratio (advance_rate) and the advance follows the block's own speed curve, whether
+     * trapezoid or S-curve. The speed is taken from the interval of this ISR, with an optional
+     * first-order smoothing over advance_smooth_time. The difference to the advance issued so far
+     * is queued in LA_steps for advance_isr, together with the steps of the block itself.
+     */
+    void Stepper::advance_track(const uint32_t interval) {
+      if (LA_advance_rate || LA_pressure || LA_adv_steps) {
+        // Step events per second, scaled up by the oversampling factor
+        const uint32_t rate = (uint32_t(STEPPER_TIMER_RATE) / interval) * steps_per_isr;
+        uint64_t target = (uint64_t(rate) * LA_advance_rate) >> (8 + oversampling_factor); // Q16 steps
+        NOMORE(target, uint64_t(INT32_MAX >> 1));
+
+        if (LA_smooth_k) {
+          // Move towards the target by interval / (smoothing time * STEPPER_TIMER_RATE)
+          const uint64_t k = uint64_t(interval) * LA_smooth_k;
+          if (k >> 32)
+            LA_pressure = int32_t(target);
+          else
+            LA_pressure += int32_t((int64_t(int32_t(target) - LA_pressure) * int64_t(k)) >> 32);
+        }
+        else
+          LA_pressure = int32_t(target);
+
+        // Queue the advance steps, keeping LA_steps within its range
+        int32_t delta = ((LA_pressure + 0x8000) >> 16) - LA_adv_steps;
+        NOMORE(delta, int32_t(INT8_MAX) - LA_steps);
+        NOLESS(delta, int32_t(INT8_MIN) - LA_steps);
+        LA_steps += delta;
+        LA_adv_steps += delta;
+      }
+
+      if (LA_steps) initiateLA();
+    }
+
+    void Stepper::set_advance_smooth_time(const float t) {
+      advance_smooth_time = t;
+      const float ticks = t * (STEPPER_TIMER_RATE);
+      LA_smooth_k = ticks > 1.0f ? uint32_t(4294967296.0f / ticks) : 0;
+    }
+
+  #endif // LA_PRESSURE_PROFILE
+
 #endif // LIN_ADVANCE
 
+#if HAS_SHAPING
+
+  // Timer interrupt for the delayed impulses of Input Shaping
+  uint32_t Stepper::shaping_isr() {
+    ISR_PROBE(SHAPING_PHASE);
+
+    xy_bool_t step_needed{0};
+
+    #if ISR_MULTI_STEPS
+      // Keep the step pins low for the minimum time after the pulse phase
+      USING_TIMED_PULSE();
+      START_LOW_PULSE();
+    #endif
+
+    for (;;) {
+      const bool replay_x = TERN0(INPUT_SHAPING_X, shaping_x.replay(shaping_time)),
+                 replay_y = TERN0(INPUT_SHAPING_Y, shaping_y.replay(shaping_time));
+      if (!replay_x && !replay_y) break;
+
+      #if ENABLED(INPUT_SHAPING_X)
+        SHAPED_STEP_PREP(X);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        SHAPED_STEP_PREP(Y);
+      #endif
+      if (!step_needed.x && !step_needed.y) continue;
+
+      #if ISR_MULTI_STEPS
+        AWAIT_LOW_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        PULSE_START(X);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        PULSE_START(Y);
+      #endif
+
+      #if ISR_MULTI_STEPS
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        PULSE_STOP(X);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        PULSE_STOP(Y);
+      #endif
+
+      #if ISR_MULTI_STEPS
+        START_LOW_PULSE();
+      #endif
+    }
+
+    return _MIN(
+      TERN(INPUT_SHAPING_X, shaping_x.next_echo(shaping_time), SHAPING_NEVER),
+      TERN(INPUT_SHAPING_Y, shaping_y.next_echo(shaping_time), SHAPING_NEVER)
+    );
+  }
+
+  /**
+   * Compute the impulses of each shaped axis from shaping_params.
+   * Queued echoes use the current impulses, so wait for all motion to finish.
+   */
+  void Stepper::refresh_shaping() {
+    planner.synchronize();
+
+    auto refresh = [](shaping_t &shaping, const shaping_params_t &params) {
+      float amp[3] = { 1 }, at[3] = { 0 };
+      uint8_t echoes = 0;
+
+      if (params.frequency > 0) {
+        const float df = SQRT(1.0f - sq(params.zeta)),
+                    td = 1.0f / (params.frequency * df),    // Damped period
+                    K = expf(-params.zeta * float(M_PI) / df);
+        switch (params.type) {
+          default:
+          case SHAPER_ZV:
+            echoes = 1;
+            amp[1] = K;                 at[1] = 0.5f * td;
+            break;
+          case SHAPER_ZVD:
+            echoes = 2;
+            amp[1] = 2.0f * K;          at[1] = 0.5f * td;
+            amp[2] = sq(K);             at[2] = td;
+            break;
+          case SHAPER_MZV: {
+            const float K2 = expf(-0.75f * params.zeta * float(M_PI) / df), a1 = 1.0f - float(M_SQRT1_2);
+            echoes = 2;
+            amp[0] = a1;
+            amp[1] = (float(M_SQRT2) - 1.0f) * K2; at[1] = 0.375f * td;
+            amp[2] = a1 * sq(K2);                  at[2] = 0.75f * td;
+          } break;
+        }
+      }
+
+      float sum = 0;
+      for (uint8_t k = 0; k <= echoes; ++k) sum += amp[k];
+
+      shaping.active = false;
+      shaping.echoes = echoes;
+      shaping.enabled = echoes > 0;
+      shaping.factor[0] = 128;
+      for (uint8_t k = 1; k <= echoes; ++k) {
+        shaping.factor[k] = LROUND(128.0f * amp[k] / sum);
+        shaping.factor[0] -= shaping.factor[k];
+        shaping.delay[k - 1] = uint32_t(at[k] * (STEPPER_TIMER_RATE));
+        shaping.head[k - 1] = shaping.tail;
+      }
+    };
+
+    const bool was_enabled = suspend();
+    TERN_(INPUT_SHAPING_X, refresh(shaping_x, shaping_params[X_AXIS]));
+    TERN_(INPUT_SHAPING_Y, refresh(shaping_y, shaping_params[Y_AXIS]));
+    if (was_enabled) wake_up();
+  }
+
+#endif // HAS_SHAPING
+
+#if ENABLED(BACKLASH_STREAM)
+
+  // Timer interrupt for the backlash takeup stream. The steps don't count toward the position.
+  uint32_t Stepper::backlash_isr() {
+    ISR_PROBE(BACKLASH_PHASE);
+
+    xyz_bool_t step_needed{0};
+    #define BACKLASH_STEP_PREP(A) do{ \
+      step_needed[_AXIS(A)] = backlash_todo[_AXIS(A)] > 0; \
+      if (step_needed[_AXIS(A)]) backlash_todo[_AXIS(A)]--; \
+    }while(0)
+
+    BACKLASH_STEP_PREP(X);
+    BACKLASH_STEP_PREP(Y);
+    BACKLASH_STEP_PREP(Z);
+    if (!step_needed.x && !step_needed.y && !step_needed.z) return BACKLASH_NEVER;
+
+    #if ISR_MULTI_STEPS
+      // Keep the step pins low for the minimum time after the pulse phase
+      USING_TIMED_PULSE();
+      START_LOW_PULSE();
+      AWAIT_LOW_PULSE();
+    #endif
+
+    PULSE_START(X);
+    PULSE_START(Y);
+    PULSE_START(Z);
+
+    #if ISR_MULTI_STEPS
+      START_HIGH_PULSE();
+      AWAIT_HIGH_PULSE();
+    #endif
+
+    PULSE_STOP(X);
+    PULSE_STOP(Y);
+    PULSE_STOP(Z);
+
+    return BACKLASH_STREAM_TICKS;
+  }
+
+#endif // BACKLASH_STREAM
+
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
   uint32_t Stepper::babystepping_isr() {
+    ISR_PROBE(BABYSTEP_PHASE);
+
     babystep.task();
-    return babystep.has_steps() ? BABYSTEP_TICKS : BABYSTEP_NEVER;
+    #if ENABLED(BABYSTEP_SMOOTHING)
+      const uint32_t interval = babystep.next_interval();
+      return interval ? interval : BABYSTEP_NEVER;
+    #else
+      return babystep.has_steps() ? BABYSTEP_TICKS : BABYSTEP_NEVER;
+    #endif
   }
 
 #endif
@@ -2454,6 +3016,81 @@ bool Stepper::is_block_busy(const block_t * const block) {
   return block == vnew;
 }
 
+#if ENABLED(STEP_TIMING_TABLE)
+
+  /**
+   * Evaluate the start, cruise and ramp intervals of a block exactly as
+   * block_phase_isr would, so the ISR only has to fetch them.
+   * Return false if an interval doesn't fit in a table entry.
+   */
+  bool Stepper::build_step_timing(const block_t * const block, step_timing_t &timing) {
+    const uint8_t oversampling = TERN0(ADAPTIVE_STEP_SMOOTHING, IS_ARC(block) ? 0 : calc_oversampling(block->nominal_rate));
+
+    bool fits = true;
+    auto entry = [&](const uint32_t rate, uint32_t &e) {
+      uint8_t loops;
+      const uint32_t interval = calc_timer_interval(rate, &loops, oversampling);
+      if (interval > 0xFFFFFFUL) fits = false;
+      e = interval | (uint32_t(loops) << 24);
+      return interval;
+    };
+
+    entry(block->initial_rate, timing.initial);
+    entry(block->nominal_rate, timing.nominal);
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+
+      // Evaluate a ramp with the coefficients of _calc_bezier_curve_coeffs
+      auto ramp = [&](const int32_t v0, const int32_t v1, const uint32_t time, uint32_t * const table, const uint8_t first) {
+        const int32_t A = 768 * (v1 - v0), B = 1920 * (v0 - v1), C = 1280 * (v1 - v0);
+        const uint32_t F = 128 * v0, AV = time ? 0xFFFFFFFF / time : 0xFFFFFFFF;
+        uint32_t t = 0;
+        for (uint8_t n = 0; n < STEP_TIMING_TABLE_SIZE; n++)
+          t += entry(n < first ? v0 : t < time ? _eval_bezier_curve(A, B, C, F, AV, t) : v1, table[n]);
+      };
+
+      ramp(block->initial_rate, block->cruise_rate, block->acceleration_time, timing.accel, 0);
+
+      // The first point of the deceleration starts at cruise rate
+      ramp(block->cruise_rate, block->final_rate, block->deceleration_time, timing.decel, 1);
+
+    #else
+
+      uint32_t t = 0;
+      for (uint8_t n = 0; n < STEP_TIMING_TABLE_SIZE; n++) {
+        uint32_t rate = STEP_MULTIPLY(t, block->acceleration_rate) + block->initial_rate;
+        NOMORE(rate, block->nominal_rate);
+        t += entry(rate, timing.accel[n]);
+      }
+
+    #endif
+
+    return fits;
+  }
+
+  /**
+   * Build the step timing of the blocks following the current one. A table slot is
+   * shared by blocks STEP_TIMING_BLOCKS apart, so the slot of the running block is
+   * never touched. The newest block is skipped, since every new move replans it.
+   * A block that changes later loses its BLOCK_BIT_STEP_TIMING in the planner.
+   */
+  void Stepper::prepare_step_timing() {
+    const uint8_t tail = planner.block_buffer_tail,
+                  moves = BLOCK_MOD(planner.block_buffer_head - tail);
+
+    for (uint8_t n = 1; n < STEP_TIMING_BLOCKS && n + 1 < moves; n++) {
+      const uint8_t b = BLOCK_MOD(tail + n);
+      block_t * const block = &planner.block_buffer[b];
+      if ((block->flag & (BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_STEP_TIMING | BLOCK_MASK_SYNC)) || IS_PAGE(block)) continue;
+      if (build_step_timing(block, step_timing[b & (STEP_TIMING_BLOCKS - 1)])) {
+        asm volatile("" : : : "memory"); // Complete the table before the ISR can see the flag
+        SBI(block->flag, BLOCK_BIT_STEP_TIMING);
+      }
+    }
+  }
+
+#endif // STEP_TIMING_TABLE
+
 void Stepper::init() {
 
   #if MB(ALLIGATOR)
@@ -2697,6 +3334,18 @@ void Stepper::init() {
     )
   );
 
+  // Shaped axes start out moving forward
+  #if ENABLED(INPUT_SHAPING_X)
+    shaping_x.forward = true;
+    X_APPLY_DIR(!INVERT_X_DIR, false);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    shaping_y.forward = true;
+    Y_APPLY_DIR(!INVERT_Y_DIR, false);
+  #endif
+
+  TERN_(LA_PRESSURE_PROFILE, set_advance_smooth_time(LA_SMOOTH_TIME));
+
   #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
     initialized = true;
     digipot_init();
@@ -2787,18 +3436,35 @@ void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
 void Stepper::endstop_triggered(const AxisEnum axis) {
 
   const bool was_enabled = suspend();
+
+  #if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+    // Interpolate the position at a stamped edge by backing out
+    // the step events of all batches that started after it
+    xyze_long_t pos = count_position;
+    const int32_t since = int32_t(pulse_cycles - endstops.edge_cycles);
+    if (endstops.at_edge && current_block && since >= 0) {
+      uint32_t events = pulse_events;
+      if (pulse_period) events += uint32_t(since) / pulse_period * steps_per_isr;
+      NOMORE(events, step_events_completed);
+      LOOP_LINEAR_AXES(i)
+        pos[i] -= count_direction[i] * int32_t(LROUND(float(events) * advance_dividend[i] / advance_divisor));
+    }
+  #else
+    const xyze_long_t &pos = count_position;
+  #endif
+
   endstops_trigsteps[axis] = (
     #if IS_CORE
       (axis == CORE_AXIS_2
-        ? CORESIGN(count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2])
-        : count_position[CORE_AXIS_1] + count_position[CORE_AXIS_2]
+        ? CORESIGN(pos[CORE_AXIS_1] - pos[CORE_AXIS_2])
+        : pos[CORE_AXIS_1] + pos[CORE_AXIS_2]
       ) * double(0.5)
     #elif ENABLED(MARKFORGED_XY)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2]
-        : count_position[CORE_AXIS_2]
+        ? pos[CORE_AXIS_1] - pos[CORE_AXIS_2]
+        : pos[CORE_AXIS_2]
     #else // !IS_CORE
-      count_position[axis]
+      pos[axis]
     #endif
   );
 
@@ -48,6 +48,9 @@
 #ifdef __AVR__
   #include "speed_lookuptable.h"
 #endif
+#if ENABLED(PLANNER_BENCHMARK)
+  #include "../feature/planner_bench.h"
+#endif
 
 // Disable multiple steps per ISR
 //#define DISABLE_MULTI_STEPPING
@@ -236,6 +239,105 @@
 // Perhaps DISABLE_MULTI_STEPPING should be required with ADAPTIVE_STEP_SMOOTHING.
 #define MIN_STEP_ISR_FREQUENCY (MAX_STEP_ISR_FREQUENCY_1X / 2)
 
+#if HAS_SHAPING
+
+  // Most steps a shaped axis can queue within the longest impulse delay
+  #ifdef SHAPING_MAX_STEPRATE
+    constexpr float max_shaped_rate = SHAPING_MAX_STEPRATE;
+  #else
+    constexpr float _ISDASU[] = DEFAULT_AXIS_STEPS_PER_UNIT, _ISDMF[] = DEFAULT_MAX_FEEDRATE;
+    constexpr float max_shaped_rate = _MAX(
+      TERN0(INPUT_SHAPING_X, _ISDASU[X_AXIS] * _ISDMF[X_AXIS]),
+      TERN0(INPUT_SHAPING_Y, _ISDASU[Y_AXIS] * _ISDMF[Y_AXIS])
+    );
+  #endif
+  // A full damped period (ZVD) is at most 1.155 / f, with zeta up to 0.5
+  #define SHAPING_QUEUE_SIZE uint16_t(1.16f * max_shaped_rate / (SHAPING_MIN_FREQ) + 4)
+  static_assert(SHAPING_QUEUE_SIZE <= 4096, "Input Shaping needs too much SRAM. Raise SHAPING_MIN_FREQ or lower SHAPING_MAX_STEPRATE.");
+
+  enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV };
+
+  // Input Shaping settings of one axis, as set by M593
+  typedef struct {
+    float frequency;    // Resonant frequency in Hz (0 = off)
+    float zeta;         // Damping ratio
+    uint8_t type;       // ShaperType
+  } shaping_params_t;
+
+  /**
+   * Input Shaping state of one stepper axis.
+   * A commanded step only moves the axis by the first impulse of the shaper, then it
+   * is queued to be replayed by the remaining impulses after their delays. The stepper
+   * takes a physical step whenever the commanded position gets half a step ahead.
+   * Impulse amplitudes are in 1/128 step, adding up to one full step.
+   */
+  typedef struct {
+    bool enabled,                             // Shaping configured (frequency > 0)
+         active,                              // Shaping the current block
+         forward;                             // Physical direction of the stepper
+    uint8_t echoes;                           // Delayed impulses (1 or 2)
+    int16_t delta_error,                      // Commanded minus physical position, in 1/128 step
+            factor[3];                        // Impulse amplitudes, in 1/128 step
+    uint32_t delay[2];                        // Echo delays in Stepper Timer ticks
+    uint32_t times[SHAPING_QUEUE_SIZE];       // Time of each queued step
+    bool dir[SHAPING_QUEUE_SIZE];             // Direction of each queued step
+    uint16_t head[2], tail;                   // Next step to replay by each echo, next free entry
+
+    static inline uint16_t next(const uint16_t i) { return i + 1 < SHAPING_QUEUE_SIZE ? i + 1 : 0; }
+
+    // The slowest echo is the last to release a step
+    inline bool empty() const { return !echoes || head[echoes - 1] == tail; }
+    inline uint16_t free_count() const {
+      if (!echoes) return SHAPING_QUEUE_SIZE - 1;
+      const int16_t used = tail - head[echoes - 1];
+      return SHAPING_QUEUE_SIZE - 1 - (used < 0 ? used + SHAPING_QUEUE_SIZE : used);
+    }
+
+    // Apply a commanded step and queue its echoes
+    FORCE_INLINE void command(const bool fwd, const uint32_t now) {
+      if (active) {
+        delta_error += fwd ? factor[0] : -factor[0];
+        times[tail] = now;
+        dir[tail] = fwd;
+        tail = next(tail);
+      }
+      else
+        delta_error += fwd ? 128 : -128;
+    }
+
+    // Apply one echo that is due. Return false if none is due.
+    FORCE_INLINE bool replay(const uint32_t now) {
+      for (uint8_t k = 0; k < echoes; ++k) {
+        const uint16_t h = head[k];
+        if (h != tail && int32_t(now - times[h] - delay[k]) >= 0) {
+          delta_error += dir[h] ? factor[k + 1] : -factor[k + 1];
+          head[k] = next(h);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Stepper Timer ticks until the next echo is due
+    inline uint32_t next_echo(const uint32_t now) const {
+      uint32_t ticks = UINT32_MAX;
+      for (uint8_t k = 0; k < echoes; ++k) if (head[k] != tail) {
+        const int32_t t = int32_t(times[head[k]] + delay[k] - now);
+        NOMORE(ticks, uint32_t(_MAX(t, int32_t(0))));
+      }
+      return ticks;
+    }
+
+    // The physical step needed to get within half a step: -1, 0 or +1
+    FORCE_INLINE int8_t settle() {
+      if (delta_error >= 64) { delta_error -= 128; return 1; }
+      if (delta_error < -64) { delta_error += 128; return -1; }
+      return 0;
+    }
+  } shaping_t;
+
+#endif
+
 //
 // Stepper class definition
 //
@@ -272,6 +374,14 @@ class Stepper {
       static bool frozen;                   // Set this flag to instantly freeze motion
     #endif
 
+    #if HAS_SHAPING
+      static shaping_params_t shaping_params[XY]; // Input Shaping settings, applied by refresh_shaping()
+    #endif
+
+    #if ENABLED(LA_PRESSURE_PROFILE)
+      static float advance_smooth_time;     // Pressure advance smoothing time (s), applied by set_advance_smooth_time()
+    #endif
+
   private:
 
     static block_t* current_block;          // A pointer to the block currently being traced
@@ -336,10 +446,18 @@ class Stepper {
 
     #if ENABLED(LIN_ADVANCE)
       static constexpr uint32_t LA_ADV_NEVER = 0xFFFFFFFF;
-      static uint32_t nextAdvanceISR, LA_isr_rate;
-      static uint16_t LA_current_adv_steps, LA_final_adv_steps, LA_max_adv_steps; // Copy from current executed block. Needed because current_block is set to NULL "too early".
+      static uint32_t nextAdvanceISR;
+      #if ENABLED(LA_PRESSURE_PROFILE)
+        static uint32_t LA_advance_rate,    // Advance steps per step event/s of the current block (Q24)
+                        LA_smooth_k;        // Smoothing factor per Stepper Timer tick (Q32), 0 for none
+        static int32_t LA_pressure,         // Smoothed advance target in steps (Q16)
+                       LA_adv_steps;        // Advance steps issued so far
+      #else
+        static uint32_t LA_isr_rate;
+        static uint16_t LA_current_adv_steps, LA_final_adv_steps, LA_max_adv_steps; // Copy from current executed block. Needed because current_block is set to NULL "too early".
+        static bool LA_use_advance_lead;
+      #endif
       static int8_t LA_steps;
-      static bool LA_use_advance_lead;
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -347,18 +465,67 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if ENABLED(BACKLASH_STREAM)
+      static constexpr uint32_t BACKLASH_NEVER = 0xFFFFFFFF;
+      static uint32_t nextBacklashISR;
+      static xyz_ulong_t backlash_todo;                 // Takeup steps still to be issued on each axis
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(ARC_BLOCKS)
+      static int32_t arc_u, arc_v,                      // Circle interpolator position (See block_arc_t)
+                     arc_ox, arc_oy,                    // Offsets to whole steps, drifting onto the target
+                     arc_x, arc_y;                      // Whole X/Y steps taken since the start of the arc
+    #endif
+
+    #if HAS_SHAPING
+      static constexpr uint32_t SHAPING_NEVER = UINT32_MAX;
+      static uint32_t nextShapingISR,
+                      shaping_time;                     // Stepper Timer ticks elapsed, for echo timing
+      #if ENABLED(INPUT_SHAPING_X)
+        static shaping_t shaping_x;
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        static shaping_t shaping_y;
+      #endif
+    #endif
+
     static int32_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
     #endif
 
+    #if ENABLED(STEP_TIMING_TABLE)
+      // Timer intervals of an upcoming block, computed ahead by the main loop.
+      // Each entry holds the interval (low 24 bits) and the steps per ISR (high 8 bits).
+      typedef struct {
+        uint32_t initial,                               // Interval at block start
+                 nominal,                               // Interval at cruise
+                 accel[STEP_TIMING_TABLE_SIZE];         // First intervals of the acceleration ramp
+        #if ENABLED(S_CURVE_ACCELERATION)
+          uint32_t decel[STEP_TIMING_TABLE_SIZE];       // First intervals of the deceleration ramp
+        #endif
+      } step_timing_t;
+
+      static step_timing_t step_timing[STEP_TIMING_BLOCKS]; // Shared by blocks STEP_TIMING_BLOCKS apart
+      static const step_timing_t *current_timing;       // Step timing of the current block, if prepared
+      static const uint32_t *timing_ramp;               // Next entry of the ramp being streamed
+      static uint8_t timing_left;                       // Entries left in the ramp being streamed
+    #endif
+
     // Exact steps at which an endstop was triggered
     static xyz_long_t endstops_trigsteps;
 
+    #if ENABLED(ENDSTOP_EDGE_TIMESTAMPS)
+      // Timing of the latest batch of step events, to place an endstop edge among them
+      static uint32_t pulse_cycles,               // cycle_count() at the start of the batch
+                      pulse_period;               // Cycles since the previous batch
+      static uint8_t pulse_events;                // Step events in the batch
+    #endif
+
     // Positions of stepper motors, in step units
     static xyze_long_t count_position;
 
@@ -392,7 +559,8 @@ class Stepper {
 
     // The stepper subsystem goes to sleep when it runs out of things to execute.
     // Call this to notify the subsystem that it is time to go to work.
-    static inline void wake_up() { ENABLE_STEPPER_DRIVER_INTERRUPT(); }
+    // A running planner benchmark keeps the ISR asleep so nothing gets stepped.
+    static inline void wake_up() { if (TERN1(PLANNER_BENCHMARK, !PlannerBench::active)) ENABLE_STEPPER_DRIVER_INTERRUPT(); }
 
     static inline bool is_awake() { return STEPPER_ISR_ENABLED(); }
 
@@ -415,6 +583,20 @@ class Stepper {
       // The Linear advance ISR phase
       static uint32_t advance_isr();
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
+      #if ENABLED(LA_PRESSURE_PROFILE)
+        // Follow the pressure profile of the current block at the given Stepper Timer interval
+        static void advance_track(const uint32_t interval);
+      #endif
+    #endif
+
+    #if HAS_SHAPING
+      // The Input Shaping echo ISR phase
+      static uint32_t shaping_isr();
+    #endif
+
+    #if ENABLED(BACKLASH_STREAM)
+      // The Backlash takeup ISR phase
+      static uint32_t backlash_isr();
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -431,6 +613,25 @@ class Stepper {
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t * const block);
 
+    #if ENABLED(STEP_TIMING_TABLE)
+      // Precompute the step timing of upcoming blocks - Called from the main loop
+      static void prepare_step_timing();
+    #endif
+
+    #if ENABLED(LA_PRESSURE_PROFILE)
+      // Set the pressure advance smoothing time - Must be called with motion stopped
+      static void set_advance_smooth_time(const float t);
+    #endif
+
+    #if HAS_SHAPING
+      // Apply new shaping_params once all motion is done
+      static void refresh_shaping();
+      // Check if any echoes of shaped steps are still queued
+      static bool shaping_busy() {
+        return TERN0(INPUT_SHAPING_X, !shaping_x.empty()) || TERN0(INPUT_SHAPING_Y, !shaping_y.empty());
+      }
+    #endif
+
     // Get the position of a stepper, in steps
     static int32_t position(const AxisEnum axis);
 
@@ -533,11 +734,11 @@ class Stepper {
     // Set the current position in steps
     static void _set_position(const abce_long_t &spos);
 
-    FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t *loops) {
+    FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t *loops, const uint8_t oversampling=oversampling_factor) {
       uint32_t timer;
 
       // Scale the frequency, as requested by the caller
-      step_rate <<= oversampling_factor;
+      step_rate <<= oversampling;
 
       uint8_t multistep = 1;
       #if DISABLED(DISABLE_MULTI_STEPPING)
@@ -593,9 +794,36 @@ class Stepper {
       return timer;
     }
 
+    #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+      // Oversampling (log2) that fits the given step event rate under MIN_STEP_ISR_FREQUENCY
+      FORCE_INLINE static uint8_t calc_oversampling(uint32_t max_rate) {
+        uint8_t oversampling = 0;                     // Assume no axis smoothing (via oversampling)
+        while (max_rate < MIN_STEP_ISR_FREQUENCY) {   // As long as more ISRs are possible...
+          max_rate <<= 1;                             // Try to double the rate
+          if (max_rate < MIN_STEP_ISR_FREQUENCY)      // Don't exceed the estimated ISR limit
+            ++oversampling;                           // Increase the oversampling (used for left-shift)
+        }
+        return oversampling;
+      }
+    #endif
+
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
+      #ifndef __AVR__
+        static int32_t _eval_bezier_curve(const int32_t A, const int32_t B, const int32_t C, const uint32_t F, const uint32_t AV, const uint32_t curr_step);
+      #endif
+    #endif
+
+    #if ENABLED(STEP_TIMING_TABLE)
+      static bool build_step_timing(const block_t * const block, step_timing_t &timing);
+
+      // Unpack a step timing entry, setting the steps per ISR
+      FORCE_INLINE static uint32_t timing_interval(const uint32_t entry) {
+        steps_per_isr = entry >> 24;
+        return entry & 0xFFFFFFUL;
+      }
+      FORCE_INLINE static uint32_t next_timing_interval() { --timing_left; return timing_interval(*timing_ramp++); }
     #endif
 
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM